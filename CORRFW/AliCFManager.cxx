@@ -34,7 +34,17 @@ AliCFManager::AliCFManager() :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fEvtPlan(),
+  fEvtPlanSel(),
+  fEvtPlanList(),
+  fEvtPlanNCuts(),
+  fPartPlan(),
+  fPartPlanSel(),
+  fPartPlanList(),
+  fPartPlanNCuts(),
+  fMaskCuts(),
+  fMaskResults()
 { 
   //
   // ctor
@@ -48,7 +58,17 @@ AliCFManager::AliCFManager(const Char_t* name, const Char_t* title) :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fEvtPlan(),
+  fEvtPlanSel(),
+  fEvtPlanList(),
+  fEvtPlanNCuts(),
+  fPartPlan(),
+  fPartPlanSel(),
+  fPartPlanList(),
+  fPartPlanNCuts(),
+  fMaskCuts(),
+  fMaskResults()
 { 
    //
    // ctor
@@ -62,7 +82,17 @@ AliCFManager::AliCFManager(const AliCFManager& c) :
   fEvtContainer(c.fEvtContainer),
   fPartContainer(c.fPartContainer),
   fEvtCutList(c.fEvtCutList),
-  fPartCutList(c.fPartCutList)
+  fPartCutList(c.fPartCutList),
+  fEvtPlan(),
+  fEvtPlanSel(),
+  fEvtPlanList(),
+  fEvtPlanNCuts(),
+  fPartPlan(),
+  fPartPlanSel(),
+  fPartPlanList(),
+  fPartPlanNCuts(),
+  fMaskCuts(),
+  fMaskResults()
 { 
    //
    //copy ctor
@@ -84,6 +114,8 @@ AliCFManager& AliCFManager::operator=(const AliCFManager& c)
   this->fPartContainer=c.fPartContainer;
   this->fEvtCutList=c.fEvtCutList;
   this->fPartCutList=c.fPartCutList;
+  this->fEvtPlanNCuts.clear();
+  this->fPartPlanNCuts.clear();
   return *this ;
 }
 
@@ -105,12 +137,9 @@ Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, const TString
     return kTRUE;
   }
   if(!fPartCutList[isel])return kTRUE;
-  TObjArrayIter iter(fPartCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+  const std::vector<AliCFCutBase*> &plan = GetCutPlan(kFALSE,isel,selcuts);
+  for (UInt_t icut=0; icut<plan.size(); icut++) {
+    if(!plan[icut]->IsSelected(obj)) return kFALSE;
   }
   return kTRUE;
 }
@@ -126,16 +155,33 @@ Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &se
       return kTRUE;
   }
   if(!fEvtCutList[isel])return kTRUE;
-  TObjArrayIter iter(fEvtCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+  const std::vector<AliCFCutBase*> &plan = GetCutPlan(kTRUE,isel,selcuts);
+  for (UInt_t icut=0; icut<plan.size(); icut++) {
+    if(!plan[icut]->IsSelected(obj)) return kFALSE;
   }
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+UInt_t AliCFManager::CheckParticleCutsMask(TObject *obj, Int_t firstStep, Int_t lastStep, const TString &selcuts) const {
+  //
+  // check object obj at particle-level selections firstStep..lastStep,
+  // bit isel of the returned mask is set if obj passes selection isel
+  //
+
+  return CheckCutsMask(kFALSE,obj,firstStep,lastStep,selcuts);
+}
+
+//_____________________________________________________________________________
+UInt_t AliCFManager::CheckEventCutsMask(TObject *obj, Int_t firstStep, Int_t lastStep, const TString &selcuts) const {
+  //
+  // check object obj at event-level selections firstStep..lastStep,
+  // bit isel of the returned mask is set if obj passes selection isel
+  //
+
+  return CheckCutsMask(kTRUE,obj,firstStep,lastStep,selcuts);
+}
+
 //_____________________________________________________________________________
 void  AliCFManager::SetMCEventInfo(const TObject *obj) const {
 
@@ -243,6 +289,7 @@ void AliCFManager::SetEventCutsList(Int_t isel, TObjArray* array) {
     return;
   }
   fEvtCutList[isel] = array;
+  InvalidateCutPlan(kTRUE,isel);
 }
 
 //_____________________________________________________________________________
@@ -267,4 +314,99 @@ void AliCFManager::SetParticleCutsList(Int_t isel, TObjArray* array) {
     return;
   }
   fPartCutList[isel] = array;
+  InvalidateCutPlan(kFALSE,isel);
+}
+
+//_____________________________________________________________________________
+const std::vector<AliCFCutBase*> &AliCFManager::GetCutPlan(Bool_t isEvt, Int_t isel, const TString &selcuts) const {
+  //
+  // cuts of the list of selection step isel selected by selcuts, in the
+  // order of the list. The plan is compiled once and reused as long as
+  // the list (pointer and size) and the selection string do not change.
+  //
+
+  std::vector<std::vector<AliCFCutBase*> > &plans = isEvt ? fEvtPlan     : fPartPlan;
+  std::vector<TString>                     &sels  = isEvt ? fEvtPlanSel  : fPartPlanSel;
+  std::vector<const TObjArray*>            &lists = isEvt ? fEvtPlanList : fPartPlanList;
+  std::vector<Int_t>                       &ncuts = isEvt ? fEvtPlanNCuts: fPartPlanNCuts;
+  TObjArray *list = isEvt ? fEvtCutList[isel] : fPartCutList[isel];
+
+  if ((Int_t)ncuts.size() <= isel) {
+    Int_t nstep = isEvt ? fNStepEvt : fNStepPart;
+    plans.resize(nstep);
+    sels .resize(nstep);
+    lists.resize(nstep,0x0);
+    ncuts.resize(nstep,-1);
+  }
+
+  std::vector<AliCFCutBase*> &plan = plans[isel];
+  if (ncuts[isel] == list->GetEntriesFast() && lists[isel] == list && sels[isel] == selcuts) return plan;
+
+  plan.clear();
+  TObjArrayIter iter(list);
+  AliCFCutBase *cut = 0;
+  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
+    TString cutName=cut->GetName();
+    if (CompareStrings(cutName,selcuts)) plan.push_back(cut);
+  }
+  sels[isel]  = selcuts;
+  lists[isel] = list;
+  ncuts[isel] = list->GetEntriesFast();
+  return plan;
+}
+
+//_____________________________________________________________________________
+void AliCFManager::InvalidateCutPlan(Bool_t isEvt, Int_t isel) {
+  //
+  // force the recompilation of the plan of selection step isel
+  //
+
+  std::vector<Int_t> &ncuts = isEvt ? fEvtPlanNCuts : fPartPlanNCuts;
+  if (isel < (Int_t)ncuts.size()) ncuts[isel] = -1;
+}
+
+//_____________________________________________________________________________
+UInt_t AliCFManager::CheckCutsMask(Bool_t isEvt, TObject *obj, Int_t firstStep, Int_t lastStep, const TString &selcuts) const {
+  //
+  // check obj at steps firstStep..lastStep, same decisions as Check*Cuts.
+  // The decision of a cut used at several steps is evaluated once, except
+  // for cuts with QA on, which fill their histograms at each call.
+  //
+
+  Int_t nstep = isEvt ? fNStepEvt : fNStepPart;
+  TObjArray **cutLists = isEvt ? fEvtCutList : fPartCutList;
+  if (lastStep < 0 || lastStep >= nstep) lastStep = nstep-1;
+  if (lastStep > 31) {
+    AliWarning(Form("Only the first 32 selection steps can be checked at once, requested up to step %i", lastStep));
+    lastStep = 31;
+  }
+  if (firstStep < 0) firstStep = 0;
+
+  fMaskCuts.clear();
+  fMaskResults.clear();
+  UInt_t mask = 0;
+  for (Int_t isel=firstStep; isel<=lastStep; isel++) {
+    Bool_t pass = kTRUE;
+    if (cutLists && cutLists[isel]) {
+      const std::vector<AliCFCutBase*> &plan = GetCutPlan(isEvt,isel,selcuts);
+      for (UInt_t icut=0; pass && icut<plan.size(); icut++) {
+        AliCFCutBase *cut = plan[icut];
+        if (cut->IsQAOn()) {
+          pass = cut->IsSelected(obj);
+          continue;
+        }
+        UInt_t imemo = 0;
+        while (imemo<fMaskCuts.size() && fMaskCuts[imemo]!=cut) imemo++;
+        if (imemo<fMaskCuts.size()) {
+          pass = fMaskResults[imemo];
+        } else {
+          pass = cut->IsSelected(obj);
+          fMaskCuts.push_back(cut);
+          fMaskResults.push_back(pass);
+        }
+      }
+    }
+    if (pass) mask |= (1u << isel);
+  }
+  return mask;
 }
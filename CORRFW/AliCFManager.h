@@ -24,10 +24,13 @@
 // now the number of steps are fixed by the particle/event containers themselves.
 //
 
+#include <vector>
 #include "TNamed.h"
 #include "AliCFContainer.h"
 #include "AliLog.h"
 
+class AliCFCutBase;
+
 //____________________________________________________________________________
 class AliCFManager : public TNamed 
 {
@@ -116,6 +119,14 @@ class AliCFManager : public TNamed
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
 
+  //Bulk checkers: the object is checked at all steps from firstStep to
+  //lastStep (-1 = last step) and bit isel of the returned mask is set if it
+  //passes step isel. Same result as calling Check*Cuts for each step, but
+  //cuts shared between steps (and without QA) are evaluated only once.
+  //At most the first 32 steps can be checked.
+  virtual UInt_t CheckEventCutsMask(TObject *obj, Int_t firstStep=0, Int_t lastStep=-1, const TString &selcuts="all") const;
+  virtual UInt_t CheckParticleCutsMask(TObject *obj, Int_t firstStep=0, Int_t lastStep=-1, const TString &selcuts="all") const;
+
  private:
   
   //number of steps
@@ -130,9 +141,25 @@ class AliCFManager : public TNamed
   //Particle-level selections
   TObjArray **fPartCutList ; //[fNStepPart] arrays of cuts for each particle-selection level
 
+  //Compiled cut plans: for each step the cuts of the list selected by the
+  //last selection string, rebuilt when the list or the string changes
+  mutable std::vector<std::vector<AliCFCutBase*> > fEvtPlan;  //! selected event cuts for each step
+  mutable std::vector<TString> fEvtPlanSel;                   //! selection string of each event plan
+  mutable std::vector<const TObjArray*> fEvtPlanList;         //! cut list of each event plan
+  mutable std::vector<Int_t> fEvtPlanNCuts;                   //! size of the cut list of each event plan (-1 = not compiled)
+  mutable std::vector<std::vector<AliCFCutBase*> > fPartPlan; //! selected particle cuts for each step
+  mutable std::vector<TString> fPartPlanSel;                  //! selection string of each particle plan
+  mutable std::vector<const TObjArray*> fPartPlanList;        //! cut list of each particle plan
+  mutable std::vector<Int_t> fPartPlanNCuts;                  //! size of the cut list of each particle plan (-1 = not compiled)
+  mutable std::vector<const AliCFCutBase*> fMaskCuts;         //! cuts already evaluated in Check*CutsMask
+  mutable std::vector<Bool_t> fMaskResults;                   //! their decisions
+
   Bool_t CompareStrings(const TString  &cutname,const TString  &selcuts) const;
+  const std::vector<AliCFCutBase*> &GetCutPlan(Bool_t isEvt, Int_t isel, const TString &selcuts) const;
+  void InvalidateCutPlan(Bool_t isEvt, Int_t isel);
+  UInt_t CheckCutsMask(Bool_t isEvt, TObject *obj, Int_t firstStep, Int_t lastStep, const TString &selcuts) const;
 
-  ClassDef(AliCFManager,2);
+  ClassDef(AliCFManager,3);
 };
 
 
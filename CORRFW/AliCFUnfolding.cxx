@@ -92,6 +92,12 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TRandom3.h"
+#include <algorithm>
+#include <map>
+#include <utility>
+#if __cplusplus >= 201103L
+#include <thread>
+#endif
 
 
 ClassImp(AliCFUnfolding)
@@ -130,7 +136,33 @@ AliCFUnfolding::AliCFUnfolding() :
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(0)
+  fRandomSeed(0),
+  fNWorkerThreads(0),
+  fEngineStatus(0),
+  fStoreEst(kStoreDouble),
+  fStoreInv(kStoreDouble),
+  fStoreUnf(kStoreDouble),
+  fCellCoordM(),
+  fCellCoordT(),
+  fRowStart(),
+  fRowT(),
+  fRowCond(),
+  fRowPos(),
+  fRowInv(),
+  fColStart(),
+  fColM(),
+  fColInv(),
+  fInvValue(),
+  fInvSet(),
+  fVecMeasured(),
+  fVecEst(),
+  fVecEstFirst(),
+  fVecEff(),
+  fVecPriorEff(),
+  fVecUnf(),
+  fVecUnfPrev(),
+  fVecUnfLast(),
+  fVecUnfFirst()
 {
   //
   // default constructor
@@ -174,7 +206,33 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(randomSeed)
+  fRandomSeed(randomSeed),
+  fNWorkerThreads(0),
+  fEngineStatus(0),
+  fStoreEst(kStoreDouble),
+  fStoreInv(kStoreDouble),
+  fStoreUnf(kStoreDouble),
+  fCellCoordM(),
+  fCellCoordT(),
+  fRowStart(),
+  fRowT(),
+  fRowCond(),
+  fRowPos(),
+  fRowInv(),
+  fColStart(),
+  fColM(),
+  fColInv(),
+  fInvValue(),
+  fInvSet(),
+  fVecMeasured(),
+  fVecEst(),
+  fVecEstFirst(),
+  fVecEff(),
+  fVecPriorEff(),
+  fVecUnf(),
+  fVecUnfPrev(),
+  fVecUnfLast(),
+  fVecUnfFirst()
 {
   //
   // named constructor
@@ -274,6 +332,8 @@ void AliCFUnfolding::Init() {
   fDeltaUnfoldedN->SetTitle("");
   fDeltaUnfoldedN->Reset();
 
+  // arrays used by the bayes iterations
+  BuildEngine();
 
 }
 
@@ -353,11 +413,16 @@ void AliCFUnfolding::Unfold() {
   Int_t iIterBayes     = 0 ;
   Double_t convergence = 0.;
 
+  if (fEngineStatus>0) EngineLoadInputs(); // efficiency and measured change for each randomized distribution
+
   for (iIterBayes=0; iIterBayes<fMaxNumIterations; iIterBayes++) { // bayes iterations
 
-    CreateEstMeasured(); // create measured estimate from prior
-    CreateInvResponse(); // create inverse response  from prior
-    CreateUnfolded();    // create unfoled spectrum  from measured and inverse response
+    if (fEngineStatus>0) EngineIterate(); // same as the 3 steps below, on arrays
+    else {
+      CreateEstMeasured(); // create measured estimate from prior
+      CreateInvResponse(); // create inverse response  from prior
+      CreateUnfolded();    // create unfoled spectrum  from measured and inverse response
+    }
 
     convergence = GetConvergence();
     AliDebug(0,Form("convergence at iteration %d is %e",iIterBayes,convergence));
@@ -371,6 +436,7 @@ void AliCFUnfolding::Unfold() {
     if (fUseSmoothing) {
       if (Smooth()) {
 	AliError("Couldn't smooth the unfolded spectrum!!");
+	if (fEngineStatus>0) EngineFlush();
 	if (fNCalcCorrErrors>0) {
 	  AliInfo(Form("=======================\nUnfold of randomized distribution finished at iteration %d with convergence %e \n",iIterBayes,convergence));
 	}
@@ -388,6 +454,8 @@ void AliCFUnfolding::Unfold() {
 
   } // end bayes iteration
 
+  if (fEngineStatus>0) EngineFlush();
+
   if (fNCalcCorrErrors==0) fUnfoldedFinal = (THnSparse*) fUnfolded->Clone() ;
 
   //
@@ -862,3 +930,301 @@ void AliCFUnfolding::CreateFlatPrior() {
   delete [] bin;
   delete [] bins;
 }
+
+//______________________________________________________________
+
+static Int_t GetEngineCell(const Int_t* coord, Int_t nVar, const Long64_t* nCellsAxis,
+			   std::map<Long64_t,Int_t> &cells, std::vector<Int_t> &cellCoord) {
+  //
+  // index of the cell with coordinates coord[0..nVar-1], created if needed
+  //
+  Long64_t key = 0;
+  for (Int_t iVar=0; iVar<nVar; iVar++) key = key*nCellsAxis[iVar] + coord[iVar];
+  std::map<Long64_t,Int_t>::const_iterator it = cells.find(key);
+  if (it != cells.end()) return it->second;
+  Int_t cell = (Int_t)cells.size();
+  cells[key] = cell;
+  for (Int_t iVar=0; iVar<nVar; iVar++) cellCoord.push_back(coord[iVar]);
+  return cell;
+}
+
+//______________________________________________________________
+
+Int_t AliCFUnfolding::StorageType(const THnSparse* h) {
+  //
+  // precision in which the bin contents of h are stored
+  //
+  if (!h) return kStoreOther;
+  if (h->InheritsFrom(THnSparseD::Class())) return kStoreDouble;
+  if (h->InheritsFrom(THnSparseF::Class())) return kStoreFloat;
+  return kStoreOther;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::BuildEngine() {
+  //
+  // Converts the conditional matrix and the inverse response into arrays indexed by
+  // measured (M) and true (T) cells. This is done once : the conditional matrix does 
+  // not change afterwards and the inverse response is only modified through the arrays.
+  //
+  // The conditional entries are grouped by M cell (CSR) and the inverse response entries
+  // by T cell (CSC), both in THnSparse bin order. Each cell of the measured estimate and
+  // of the unfolded spectrum then sums the same terms in the same order as the loops of
+  // CreateEstMeasured and CreateUnfolded, independently of the other cells.
+  //
+
+  fEngineStatus = -1;
+  fStoreEst = StorageType(fMeasuredEstimate);
+  fStoreInv = StorageType(fInverseResponse);
+  fStoreUnf = StorageType(fUnfolded);
+  if (fStoreEst==kStoreOther || fStoreInv==kStoreOther || fStoreUnf==kStoreOther || StorageType(fPrior)!=fStoreUnf) {
+    AliInfo("Spectra are neither in double nor in float precision : iterations will loop on the THnSparse");
+    return;
+  }
+
+  const Int_t nVar = fNVariables;
+  std::vector<Long64_t> nCellsAxis(2*nVar);
+  for (Int_t iDim=0; iDim<2*nVar; iDim++) nCellsAxis[iDim] = fInverseResponse->GetAxis(iDim)->GetNbins() + 2;
+  std::map<Long64_t,Int_t> cellsM, cellsT;
+  fCellCoordM.clear();
+  fCellCoordT.clear();
+  std::vector<Int_t> coord(2*nVar);
+
+  // inverse response entries
+  const Long64_t nInv = fInverseResponse->GetNbins();
+  fInvValue.resize(nInv);
+  fInvSet.assign(nInv,0);
+  std::vector<Int_t> invM(nInv), invT(nInv);
+  for (Long64_t iBin=0; iBin<nInv; iBin++) {
+    fInvValue[iBin] = fInverseResponse->GetBinContent(iBin,&coord[0]);
+    invM[iBin] = GetEngineCell(&coord[0],   nVar,&nCellsAxis[0],   cellsM,fCellCoordM);
+    invT[iBin] = GetEngineCell(&coord[nVar],nVar,&nCellsAxis[nVar],cellsT,fCellCoordT);
+  }
+
+  // conditional entries
+  const Long64_t nCond = fConditional->GetNbins();
+  std::vector<Int_t>    condM(nCond), condT(nCond);
+  std::vector<Double_t> condValue(nCond);
+  std::vector<Long64_t> condInv(nCond);
+  for (Long64_t iBin=0; iBin<nCond; iBin++) {
+    condValue[iBin] = fConditional->GetBinContent(iBin,&coord[0]);
+    condInv[iBin]   = fInverseResponse->GetBin(&coord[0],kFALSE);
+    if (condInv[iBin]<0) {
+      AliWarning("Conditional matrix and inverse response have different bins : iterations will loop on the THnSparse");
+      return;
+    }
+    condM[iBin] = GetEngineCell(&coord[0],   nVar,&nCellsAxis[0],   cellsM,fCellCoordM);
+    condT[iBin] = GetEngineCell(&coord[nVar],nVar,&nCellsAxis[nVar],cellsT,fCellCoordT);
+  }
+
+  const Int_t nM = (Int_t)cellsM.size();
+  const Int_t nT = (Int_t)cellsT.size();
+
+  // conditional entries by M cell
+  fRowStart.assign(nM+1,0);
+  for (Long64_t iBin=0; iBin<nCond; iBin++) fRowStart[condM[iBin]+1]++;
+  for (Int_t iCell=0; iCell<nM; iCell++) fRowStart[iCell+1] += fRowStart[iCell];
+  std::vector<Int_t> next(fRowStart.begin(),fRowStart.end()-1);
+  fRowT.resize(nCond);
+  fRowCond.resize(nCond);
+  fRowPos.resize(nCond);
+  fRowInv.resize(nCond);
+  for (Long64_t iBin=0; iBin<nCond; iBin++) {
+    Int_t k = next[condM[iBin]]++;
+    fRowT[k]    = condT[iBin];
+    fRowCond[k] = condValue[iBin];
+    fRowPos[k]  = iBin;
+    fRowInv[k]  = condInv[iBin];
+  }
+
+  // inverse response entries by T cell
+  fColStart.assign(nT+1,0);
+  for (Long64_t iBin=0; iBin<nInv; iBin++) fColStart[invT[iBin]+1]++;
+  for (Int_t iCell=0; iCell<nT; iCell++) fColStart[iCell+1] += fColStart[iCell];
+  next.assign(fColStart.begin(),fColStart.end()-1);
+  fColM.resize(nInv);
+  fColInv.resize(nInv);
+  for (Long64_t iBin=0; iBin<nInv; iBin++) {
+    Int_t k = next[invT[iBin]]++;
+    fColM[k]   = invM[iBin];
+    fColInv[k] = iBin;
+  }
+
+  fVecMeasured.assign(nM,0.);
+  fVecEst     .assign(nM,0.);
+  fVecEstFirst.assign(nM,-1);
+  fVecEff     .assign(nT,0.);
+  fVecPriorEff.assign(nT,0.);
+  fVecUnf     .assign(nT,0.);
+  fVecUnfPrev .assign(nT,0.);
+  fVecUnfLast .assign(nT,0.);
+  fVecUnfFirst.assign(nT,-1);
+
+  fEngineStatus = 1;
+  AliInfo(Form("Iterating on arrays : %lld conditional entries, %d measured cells, %d true cells",nCond,nM,nT));
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::EngineLoadInputs() {
+  //
+  // reads the measured spectrum and the efficiency in each cell
+  //
+  for (UInt_t iCell=0; iCell<fVecMeasured.size(); iCell++) 
+    fVecMeasured[iCell] = fMeasured->GetBinContent(&fCellCoordM[iCell*fNVariables]);
+  for (UInt_t iCell=0; iCell<fVecEff.size(); iCell++) 
+    fVecEff[iCell] = fEfficiency->GetBinContent(&fCellCoordT[iCell*fNVariables]);
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::EngineIterate() {
+  //
+  // One bayes iteration on the arrays (CreateEstMeasured, CreateInvResponse and CreateUnfolded).
+  // fUnfolded is filled at the end, fMeasuredEstimate and fInverseResponse in EngineFlush()
+  //
+
+  // prior times efficiency, as THnSparse::Multiply : only prior bins, in the prior precision
+  for (UInt_t iCell=0; iCell<fVecPriorEff.size(); iCell++) {
+    Long64_t bin = fPrior->GetBin(&fCellCoordT[iCell*fNVariables],kFALSE);
+    fVecPriorEff[iCell] = (bin<0 ? 0. : Stored(fStoreUnf,fPrior->GetBinContent(bin)*fVecEff[iCell]));
+  }
+
+  EngineRun(kTRUE);  // measured estimate and inverse response
+  EngineRun(kFALSE); // unfolded
+
+  // fill the unfolded spectrum, creating the bins in the same order as CreateUnfolded.
+  // The last fill of each bin is added as in CreateUnfolded, so that errors are the same as well
+  std::vector<std::pair<Long64_t,Int_t> > order;
+  for (UInt_t iCell=0; iCell<fVecUnf.size(); iCell++) {
+    if (fVecUnfFirst[iCell]>=0) order.push_back(std::make_pair(fVecUnfFirst[iCell],(Int_t)iCell));
+  }
+  std::sort(order.begin(),order.end());
+
+  fUnfolded->Reset();
+  for (UInt_t i=0; i<order.size(); i++) {
+    Int_t iCell = order[i].second;
+    Int_t *coord = &fCellCoordT[iCell*fNVariables];
+    fUnfolded->SetBinContent(coord,fVecUnfPrev[iCell]);
+    fUnfolded->SetBinError  (coord,0.);
+    fUnfolded->AddBinContent(coord,fVecUnfLast[iCell]);
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::EngineRun(Bool_t rows) {
+  //
+  // Splits the cells among fNWorkerThreads threads.
+  // Each cell only depends on its own entries, so the result does not depend on the number of threads.
+  //
+
+  Int_t nCells = rows ? (Int_t)fVecEst.size() : (Int_t)fVecUnf.size();
+  void (AliCFUnfolding::*fcn)(Int_t,Int_t) = rows ? &AliCFUnfolding::EngineRows : &AliCFUnfolding::EngineCols;
+
+#if __cplusplus >= 201103L
+  Int_t nThreads = TMath::Min(fNWorkerThreads,nCells);
+  if (nThreads>1) {
+    std::vector<std::thread> workers;
+    workers.reserve(nThreads);
+    for (Int_t iThread=0; iThread<nThreads; iThread++) {
+      Int_t firstCell = (Int_t)((Long64_t)nCells*iThread/nThreads);
+      Int_t lastCell  = (Int_t)((Long64_t)nCells*(iThread+1)/nThreads);
+      workers.push_back(std::thread(fcn,this,firstCell,lastCell));
+    }
+    for (Int_t iThread=0; iThread<nThreads; iThread++) workers[iThread].join();
+    return;
+  }
+#endif
+  (this->*fcn)(0,nCells);
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::EngineRows(Int_t firstCell, Int_t lastCell) {
+  //
+  // measured estimate (CreateEstMeasured) and inverse response (CreateInvResponse) 
+  // for the measured cells [firstCell,lastCell)
+  //
+  for (Int_t iCell=firstCell; iCell<lastCell; iCell++) {
+    Double_t estimate = 0.;
+    Long64_t first    = -1;
+    for (Int_t k=fRowStart[iCell]; k<fRowStart[iCell+1]; k++) {
+      Double_t fill = fRowCond[k] * fVecPriorEff[fRowT[k]] ;
+      if (fill>0.) {
+	estimate = Stored(fStoreEst,estimate+fill);
+	if (first<0) first = fRowPos[k];
+      }
+    }
+    fVecEst[iCell]      = estimate;
+    fVecEstFirst[iCell] = first;
+
+    for (Int_t k=fRowStart[iCell]; k<fRowStart[iCell+1]; k++) {
+      Long64_t bin = fRowInv[k];
+      Double_t fill = (estimate>0. ? fRowCond[k] * fVecPriorEff[fRowT[k]] / estimate : 0. ) ;
+      if (fill>0. || fInvValue[bin]>0.) {
+	fInvValue[bin] = Stored(fStoreInv,fill);
+	fInvSet[bin]   = 1;
+      }
+    }
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::EngineCols(Int_t firstCell, Int_t lastCell) {
+  //
+  // unfolded spectrum (CreateUnfolded) for the true cells [firstCell,lastCell)
+  //
+  for (Int_t iCell=firstCell; iCell<lastCell; iCell++) {
+    Double_t effValue = fVecEff[iCell];
+    Double_t unfolded = 0.;
+    Double_t previous = 0.;
+    Double_t last     = 0.;
+    Long64_t first    = -1;
+    for (Int_t k=fColStart[iCell]; k<fColStart[iCell+1]; k++) {
+      Double_t fill = (effValue>0. ? fInvValue[fColInv[k]] * fVecMeasured[fColM[k]] / effValue : 0.) ;
+      if (fill>0.) {
+	previous = unfolded;
+	unfolded = Stored(fStoreUnf,unfolded+fill);
+	last     = fill;
+	if (first<0) first = fColInv[k];
+      }
+    }
+    fVecUnf[iCell]      = unfolded;
+    fVecUnfPrev[iCell]  = previous;
+    fVecUnfLast[iCell]  = last;
+    fVecUnfFirst[iCell] = first;
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::EngineFlush() {
+  //
+  // fills fInverseResponse and fMeasuredEstimate with the result of the last iteration
+  //
+
+  for (Long64_t iBin=0; iBin<(Long64_t)fInvSet.size(); iBin++) {
+    if (!fInvSet[iBin]) continue;
+    fInverseResponse->SetBinContent(iBin,fInvValue[iBin]);
+    fInverseResponse->SetBinError  (iBin,0.);
+    fInvSet[iBin] = 0;
+  }
+
+  // create the bins in the same order as CreateEstMeasured
+  std::vector<std::pair<Long64_t,Int_t> > order;
+  for (UInt_t iCell=0; iCell<fVecEst.size(); iCell++) {
+    if (fVecEstFirst[iCell]>=0) order.push_back(std::make_pair(fVecEstFirst[iCell],(Int_t)iCell));
+  }
+  std::sort(order.begin(),order.end());
+
+  fMeasuredEstimate->Reset();
+  for (UInt_t i=0; i<order.size(); i++) {
+    Int_t iCell = order[i].second;
+    Int_t *coord = &fCellCoordM[iCell*fNVariables];
+    fMeasuredEstimate->SetBinContent(coord,fVecEst[iCell]);
+    fMeasuredEstimate->SetBinError  (coord,0.);
+  }
+}
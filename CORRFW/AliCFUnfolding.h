@@ -10,6 +10,7 @@
 // Author : renaud.vernet@cern.ch                                     //
 //--------------------------------------------------------------------//
 
+#include <vector>
 #include "TNamed.h"
 #include "THnSparse.h"
 #include "AliLog.h"
@@ -36,6 +37,7 @@ class AliCFUnfolding : public TNamed {
   }
 
   void SetNRandomIterations(Int_t n = 100) {fNRandomIterations = n;};
+  void SetNWorkerThreads(Int_t n) {fNWorkerThreads = n;} // threads used in each bayes iteration (results do not depend on it)
 
   void UseSmoothing(TF1* fcn=0x0, Option_t* opt="iremn") { // if fcn=0x0 then smooth using neighbouring bins 
     fUseSmoothing=kTRUE;                                   // this function must NOT be used if fNVariables > 3
@@ -111,6 +113,37 @@ class AliCFUnfolding : public TNamed {
   THnSparse     *fDeltaUnfoldedN;    // Entries of the delta-unfolded distribution (count for each bin)
   Short_t        fNCalcCorrErrors;   // Book-keeping to prevend infinite loop
   UInt_t         fRandomSeed;        // Random seed
+  Int_t          fNWorkerThreads;    // Number of threads sharing the array engine loops (<=1 : no threads)
+
+  /* array engine : the response is converted once into arrays indexed by cell, */
+  /* the bayes iterations run on them and the THnSparse are only filled with    */
+  /* the results. Not used (THnSparse loops instead) if a spectrum is neither   */
+  /* stored in double nor in float precision.                                   */
+  Int_t                 fEngineStatus;     //! 0 : not built, 1 : in use, -1 : not supported
+  Int_t                 fStoreEst;         //! storage precision of fMeasuredEstimate
+  Int_t                 fStoreInv;         //! storage precision of fInverseResponse
+  Int_t                 fStoreUnf;         //! storage precision of fUnfolded and fPrior
+  std::vector<Int_t>    fCellCoordM;       //! coordinates of the measured cells (N per cell)
+  std::vector<Int_t>    fCellCoordT;       //! coordinates of the true cells (N per cell)
+  std::vector<Int_t>    fRowStart;         //! conditional entries of each measured cell (CSR), in fConditional bin order
+  std::vector<Int_t>    fRowT;             //! true cell of each conditional entry
+  std::vector<Double_t> fRowCond;          //! conditional probability of each entry
+  std::vector<Long64_t> fRowPos;           //! bin index of each entry in fConditional
+  std::vector<Long64_t> fRowInv;           //! bin index of each entry in fInverseResponse
+  std::vector<Int_t>    fColStart;         //! inverse response entries of each true cell (CSC), in fInverseResponse bin order
+  std::vector<Int_t>    fColM;             //! measured cell of each inverse response entry
+  std::vector<Long64_t> fColInv;           //! bin index of each entry in fInverseResponse
+  std::vector<Double_t> fInvValue;         //! content of fInverseResponse, by bin index
+  std::vector<Char_t>   fInvSet;           //! bins of fInverseResponse modified since the last flush
+  std::vector<Double_t> fVecMeasured;      //! measured spectrum, by measured cell
+  std::vector<Double_t> fVecEst;           //! measured estimate, by measured cell
+  std::vector<Long64_t> fVecEstFirst;      //! first conditional bin filling each measured cell (-1 : none)
+  std::vector<Double_t> fVecEff;           //! efficiency, by true cell
+  std::vector<Double_t> fVecPriorEff;      //! prior times efficiency, by true cell
+  std::vector<Double_t> fVecUnf;           //! unfolded spectrum, by true cell
+  std::vector<Double_t> fVecUnfPrev;       //! unfolded content before the last fill
+  std::vector<Double_t> fVecUnfLast;       //! last fill of the unfolded content
+  std::vector<Long64_t> fVecUnfFirst;      //! first inverse response bin filling each true cell (-1 : none)
 
 
   // functions
@@ -132,7 +165,20 @@ class AliCFUnfolding : public TNamed {
   void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
   void     SetMaxConvergencePerDOF (Double_t val);
 
-  ClassDef(AliCFUnfolding,1);
+  /* array engine */
+  void     BuildEngine();                            // converts the conditional and inverse response matrices into arrays
+  void     EngineLoadInputs();                       // reads efficiency and measured spectra
+  void     EngineIterate();                          // one bayes iteration, fills fUnfolded
+  void     EngineRun(Bool_t rows);                   // runs EngineRows or EngineCols, possibly in threads
+  void     EngineRows(Int_t firstCell, Int_t lastCell); // measured estimate and inverse response for measured cells [first,last)
+  void     EngineCols(Int_t firstCell, Int_t lastCell); // unfolded spectrum for true cells [first,last)
+  void     EngineFlush();                            // fills fMeasuredEstimate and fInverseResponse
+  static Int_t    StorageType(const THnSparse* h);
+  static Double_t Stored(Int_t type, Double_t val) {return type==kStoreFloat ? (Double_t)(Float_t)val : val;}
+
+  enum {kStoreDouble=0, kStoreFloat, kStoreOther};
+
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
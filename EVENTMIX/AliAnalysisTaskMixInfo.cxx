@@ -15,6 +15,7 @@
 //
 
 #include <TList.h>
+#include <TH1D.h>
 #include <TObjString.h>
 
 #include "AliAnalysisManager.h"
@@ -35,6 +36,7 @@ AliAnalysisTaskMixInfo::AliAnalysisTaskMixInfo(const char *name)
      fInputEHMix(0),
      fOutputList(0),
      fMixInfo(0),
+     fPoolFill(0),
      fCurrentEntryTmp(-1),
      fLogType(AliLog::kInfo),
      fLogClassesString()
@@ -76,9 +78,11 @@ void AliAnalysisTaskMixInfo::UserCreateOutputObjects()
          evPool->SetBufferSize(fInputEHMix->BufferSize());
          evPool->SetMixNumber(fInputEHMix->MixNumber());
          fMixInfo->SetEventPool(evPool);
+         fPoolFill = evPool->CreateFillHistogram();
       }
    }
    if (fMixInfo) fOutputList->Add(fMixInfo);
+   if (fPoolFill) fOutputList->Add(fPoolFill);
 
    // Post output data.
    PostData(1, fOutputList);
@@ -142,6 +146,8 @@ void AliAnalysisTaskMixInfo::FinishTaskOutput()
 {
    // FinishTaskOutput
    if (fMixInfo) fMixInfo->Print();
+   // pool fill levels of this worker (summed when the outputs are merged)
+   if (fPoolFill && fInputEHMix && fInputEHMix->GetEventPool()) fInputEHMix->GetEventPool()->UpdateFillHistogram(fPoolFill);
 }
 
 
@@ -17,6 +17,7 @@
 
 class AliMixInputEventHandler;
 class TList;
+class TH1D;
 class AliMixInfo;
 class AliAnalysisTaskMixInfo : public AliAnalysisTaskSE {
 public:
@@ -45,6 +46,7 @@ private:
 
    TList                      *fOutputList;        //! output list
    AliMixInfo                 *fMixInfo;           //! mix info
+   TH1D                       *fPoolFill;          //! events added to each pool bin
 
    Long64_t                    fCurrentEntryTmp;   //! temporary current entry number
 
@@ -54,7 +56,7 @@ private:
    AliAnalysisTaskMixInfo(const AliAnalysisTaskMixInfo &); // not implemented
    AliAnalysisTaskMixInfo &operator=(const AliAnalysisTaskMixInfo &); // not implemented
 
-   ClassDef(AliAnalysisTaskMixInfo, 1); // example of analysis
+   ClassDef(AliAnalysisTaskMixInfo, 2); // example of analysis
 };
 
 #endif
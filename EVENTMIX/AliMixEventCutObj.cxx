@@ -27,7 +27,9 @@ AliMixEventCutObj::AliMixEventCutObj(AliMixEventCutObj::EEPAxis_t type, Float_t
    fCutMax(max),
    fCutStep(step),
    fCutSmallVal(0),
-   fCurrentVal(min)
+   fCurrentVal(min),
+   fBinLow(),
+   fBinHigh()
 {
    //
    // Default constructor
@@ -45,7 +47,9 @@ AliMixEventCutObj::AliMixEventCutObj(const AliMixEventCutObj &obj) : TObject(obj
    fCutMax(obj.fCutMax),
    fCutStep(obj.fCutStep),
    fCutSmallVal(obj.fCutSmallVal),
-   fCurrentVal(obj.fCurrentVal)
+   fCurrentVal(obj.fCurrentVal),
+   fBinLow(),
+   fBinHigh()
 {
    //
    // Copy constructor
@@ -69,6 +73,8 @@ AliMixEventCutObj &AliMixEventCutObj::operator=(const AliMixEventCutObj &obj)
       fCutStep = obj.fCutStep;
       fCutSmallVal = obj.fCutSmallVal;
       fCurrentVal = obj.fCurrentVal;
+      fBinLow.Set(0);
+      fBinHigh.Set(0);
 //       fNoMore = obj.fNoMore;
    }
    return *this;
@@ -137,14 +143,42 @@ Int_t AliMixEventCutObj::GetBinNumber(Float_t num) const
    // Returns bin (index) number in current cut.
    // Returns -1 in case of out of range
    //
+   if (fBinLow.GetSize() == 0) BuildBinTable();
+   const Int_t nBins = fBinLow.GetSize();
+   if (nBins == 0 || !(num >= fBinLow[0])) return -1;
+   // last bin with lower edge <= num (the bins do not overlap)
+   Int_t lo = 0, hi = nBins - 1;
+   while (lo < hi) {
+      Int_t mid = (lo + hi + 1) / 2;
+      if (num >= fBinLow[mid]) lo = mid;
+      else hi = mid - 1;
+   }
+   if (num < fBinHigh[lo]) return lo + 1;
+   return -1;
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventCutObj::BuildBinTable() const
+{
+   //
+   // Stores the bin edges exactly as they are accumulated in float
+   // when stepping from fCutMin to fCutMax
+   //
+   Int_t nBins = 0;
+   if (fCutStep <= 0) {
+      fBinLow.Set(0);
+      fBinHigh.Set(0);
+      return;
+   }
+   for (Float_t iCurrent = fCutMin; iCurrent < fCutMax; iCurrent += fCutStep) nBins++;
+   fBinLow.Set(nBins);
+   fBinHigh.Set(nBins);
    Int_t binNum = 0;
    for (Float_t iCurrent = fCutMin; iCurrent < fCutMax; iCurrent += fCutStep) {
+      fBinLow[binNum] = iCurrent;
+      fBinHigh[binNum] = iCurrent + fCutStep - fCutSmallVal;
       binNum++;
-      if ((num >= iCurrent) && (num < iCurrent + fCutStep - fCutSmallVal)) {
-         return binNum;
-      }
    }
-   return -1;
 }
 
 //_________________________________________________________________________________________________
@@ -13,6 +13,7 @@
 
 #include <TObject.h>
 #include <TString.h>
+#include <TArrayF.h>
 
 class AliVEvent;
 class AliAODEvent;
@@ -64,7 +65,12 @@ private:
 
    Float_t     fCurrentVal;    // current value
 
-   ClassDef(AliMixEventCutObj, 3)
+   mutable TArrayF fBinLow;    //! lower edges of the bins (as accumulated by the bin loop)
+   mutable TArrayF fBinHigh;   //! upper edges of the bins (excluded)
+
+   void        BuildBinTable() const;
+
+   ClassDef(AliMixEventCutObj, 4)
 };
 
 #endif
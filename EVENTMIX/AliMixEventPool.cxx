@@ -9,6 +9,8 @@
 //
 
 #include <TEntryList.h>
+#include <TH1D.h>
+#include <TMath.h>
 
 #include "AliLog.h"
 #include "AliMixEventCutObj.h"
@@ -23,7 +25,14 @@ AliMixEventPool::AliMixEventPool(const char *name, const char *title) : TNamed(n
    fListOfEventCuts(),
    fBinNumber(0),
    fBufferSize(0),
-   fMixNumber(0)
+   fMixNumber(0),
+   fMaxEntriesPerBin(0),
+   fEvictionPolicy(kEvictOldest),
+   fLastEntryStored(kFALSE),
+   fCutStride(),
+   fRingEntries(),
+   fRingN(),
+   fNAdded()
 {
    //
    // Default constructor.
@@ -37,7 +46,14 @@ AliMixEventPool::AliMixEventPool(const AliMixEventPool &obj) : TNamed(obj),
    fListOfEventCuts(obj.fListOfEventCuts),
    fBinNumber(obj.fBinNumber),
    fBufferSize(obj.fBufferSize),
-   fMixNumber(obj.fMixNumber)
+   fMixNumber(obj.fMixNumber),
+   fMaxEntriesPerBin(obj.fMaxEntriesPerBin),
+   fEvictionPolicy(obj.fEvictionPolicy),
+   fLastEntryStored(kFALSE),
+   fCutStride(),
+   fRingEntries(),
+   fRingN(),
+   fNAdded()
 {
    //
    // Copy constructor
@@ -59,6 +75,9 @@ AliMixEventPool &AliMixEventPool::operator=(const AliMixEventPool &obj)
       fBinNumber = obj.fBinNumber;
       fBufferSize = obj.fBufferSize;
       fMixNumber = obj.fMixNumber;
+      fMaxEntriesPerBin = obj.fMaxEntriesPerBin;
+      fEvictionPolicy = obj.fEvictionPolicy;
+      fCutStride.Set(0);
    }
    return *this;
 }
@@ -73,6 +92,18 @@ AliMixEventPool::~AliMixEventPool()
    AliDebug(AliLog::kDebug + 5, "<-");
    AliDebug(AliLog::kDebug + 5, "->");
 }
+//_________________________________________________________________________________________________
+void AliMixEventPool::SetMaxEntriesPerBin(Int_t maxEntries, EEvictionPolicy policy)
+{
+   //
+   // Sets the capacity of the entry ring of each bin (0: unlimited entry lists).
+   // After Init() the rings are rebuilt, the entries stored so far are dropped.
+   //
+   fMaxEntriesPerBin = maxEntries;
+   fEvictionPolicy = policy;
+   if (!NeedInit()) InitBinning();
+}
+
 //_________________________________________________________________________________________________
 void AliMixEventPool::AddCut(AliMixEventCutObj *cut)
 {
@@ -111,10 +142,32 @@ Int_t AliMixEventPool::Init()
    fBinNumber++;
    AliDebug(AliLog::kDebug, Form("fBinnumber = %d", fBinNumber));
    AddEntryList();
+   InitBinning();
    AliDebug(AliLog::kDebug + 5, "->");
    return 0;
 }
 
+//_________________________________________________________________________________________________
+void AliMixEventPool::InitBinning()
+{
+   //
+   // Precomputes the strides of the cuts in the bin index and the entry rings
+   //
+   Int_t numCuts = fListOfEventCuts.GetEntriesFast();
+   fCutStride.Set(numCuts);
+   Int_t stride = 1;
+   for (Int_t i = 0; i < numCuts; i++) {
+      fCutStride[i] = stride;
+      stride *= ((AliMixEventCutObj *) fListOfEventCuts.UncheckedAt(i))->GetNumberOfBins();
+   }
+   Int_t nBins = fListOfEntryList.GetEntriesFast();
+   fRingN.Set(nBins);
+   fRingN.Reset();
+   fNAdded.Set(nBins);
+   fNAdded.Reset();
+   fRingEntries.Set(fMaxEntriesPerBin > 0 ? nBins * fMaxEntriesPerBin : 0);
+}
+
 //_________________________________________________________________________________________________
 void AliMixEventPool::CreateEntryListsRecursivly(Int_t index)
 {
@@ -169,15 +222,28 @@ Bool_t AliMixEventPool::AddEntry(Long64_t entry, AliVEvent *ev)
    //
    AliDebug(AliLog::kDebug + 5, "<-");
    AliDebug(AliLog::kDebug + 5, Form("AddEntry(%lld,%p)", entry, (void *)ev));
+   fLastEntryStored = kFALSE;
    if (entry < 0) {
       AliDebug(AliLog::kDebug, Form("Entry %lld was NOT added !!!", entry));
       return kFALSE;
    }
-   Int_t idEntryList = -1;
-   TEntryList *el =  FindEntryList(ev, idEntryList);
-   if (el) {
-      el->Enter(entry);
+   Int_t idEntryList = FindBin(ev);
+   if (idEntryList > 0) {
+      Int_t bin = idEntryList - 1;
+      fNAdded[bin]++;
+      if (fMaxEntriesPerBin > 0) {
+         // fixed size ring of the last (or first) entries
+         if (fRingN[bin] >= fMaxEntriesPerBin && fEvictionPolicy == kKeepOldest) {
+            AliDebug(AliLog::kDebug, Form("Entry %lld was NOT added (bin %d full) !!!", entry, idEntryList));
+            return kFALSE;
+         }
+         fRingEntries[bin * fMaxEntriesPerBin + fRingN[bin] % fMaxEntriesPerBin] = entry;
+         fRingN[bin]++;
+      } else {
+         ((TEntryList *) fListOfEntryList.UncheckedAt(bin))->Enter(entry);
+      }
       AliDebug(AliLog::kDebug, Form("Entry %lld was added with idEntryList %d !!!", entry, idEntryList));
+      fLastEntryStored = kTRUE;
       return kTRUE;
    }
    AliDebug(AliLog::kDebug, Form("Entry %lld was NOT added !!!", entry));
@@ -192,33 +258,88 @@ TEntryList *AliMixEventPool::FindEntryList(AliVEvent *ev, Int_t &idEntryList)
    // Find entrlist in list of entrlist
    //
    AliDebug(AliLog::kDebug + 5, "<-");
+   if (fListOfEventCuts.GetEntriesFast() < 1) return 0;
+   Int_t id = FindBin(ev);
+   if (id < 0) return 0;
+   idEntryList = id;
+   AliDebug(AliLog::kDebug + 5, "->");
+   return (TEntryList *) fListOfEntryList.UncheckedAt(idEntryList - 1);
+}
+
+//_________________________________________________________________________________________________
+Int_t AliMixEventPool::FindBin(AliVEvent *ev)
+{
+   //
+   // Index of the bin of event ev (starting at 1, as idEntryList), -1 if it is
+   // out of the range of one of the cuts
+   //
    Int_t num = fListOfEventCuts.GetEntriesFast();
-   if (num < 1) return 0;
-   Int_t *indexes = new Int_t[num] ;
-   Int_t *lenght = new Int_t[num];
-   Int_t i = 0;
-   TObjArrayIter next(&fListOfEventCuts);
-   AliMixEventCutObj *cut;
-   while ((cut = (AliMixEventCutObj *) next())) {
-      indexes[i] = cut->GetIndex(ev);
-      if (indexes[i] < 0) {
+   if (num < 1) return -1;
+   if (fCutStride.GetSize() != num) InitBinning();
+   Int_t index = 1;
+   for (Int_t i = 0; i < num; i++) {
+      Int_t binCut = ((AliMixEventCutObj *) fListOfEventCuts.UncheckedAt(i))->GetIndex(ev);
+      if (binCut < 0) {
          AliDebug(AliLog::kDebug, Form("idEntryList %d", -1));
-         delete [] indexes;
-         delete [] lenght;
-         return 0;
+         return -1;
       }
-      lenght[i] = cut->GetNumberOfBins();
-      AliDebug(AliLog::kDebug + 1, Form("indexes[%d] %d", i, indexes[i]));
-      i++;
+      index += (binCut - 1) * fCutStride[i];
    }
-   idEntryList = 0;
-   SearchIndexRecursive(fListOfEventCuts.GetEntries() - 1, &indexes[0], &lenght[0], idEntryList);
-   AliDebug(AliLog::kDebug, Form("idEntryList %d", idEntryList - 1));
-   // index which start with 0 (idEntryList-1)
-   delete [] indexes;
-   delete [] lenght;
-   AliDebug(AliLog::kDebug + 5, "->");
-   return (TEntryList *) fListOfEntryList.At(idEntryList - 1);
+   if (index > fListOfEntryList.GetEntriesFast()) return -1;
+   AliDebug(AliLog::kDebug, Form("idEntryList %d", index - 1));
+   return index;
+}
+
+//_________________________________________________________________________________________________
+Long64_t AliMixEventPool::GetNEntries(Int_t idEntryList) const
+{
+   //
+   // Number of entries held by the bin (at most fMaxEntriesPerBin if set)
+   //
+   if (idEntryList < 1 || idEntryList > fListOfEntryList.GetEntriesFast()) return 0;
+   Int_t bin = idEntryList - 1;
+   if (fMaxEntriesPerBin <= 0) return ((TEntryList *) fListOfEntryList.UncheckedAt(bin))->GetN();
+   if (bin >= fRingN.GetSize()) return 0;
+   return TMath::Min(fRingN[bin], (Long64_t) fMaxEntriesPerBin);
+}
+
+//_________________________________________________________________________________________________
+Long64_t AliMixEventPool::GetEntry(Int_t idEntryList, Long64_t index) const
+{
+   //
+   // Entry number 'index' of the entries held by the bin, 0 being the oldest one
+   // (0 <= index < GetNEntries(idEntryList)); -1 if out of range
+   //
+   if (idEntryList < 1 || idEntryList > fListOfEntryList.GetEntriesFast() || index < 0) return -1;
+   Int_t bin = idEntryList - 1;
+   if (fMaxEntriesPerBin <= 0) return ((TEntryList *) fListOfEntryList.UncheckedAt(bin))->GetEntry(index);
+   if (bin >= fRingN.GetSize() || index >= GetNEntries(idEntryList)) return -1;
+   // the ring holds the entries fRingN-held ... fRingN-1 (numbered from the first one ever added)
+   Long64_t first = fRingN[bin] - GetNEntries(idEntryList);
+   return fRingEntries[bin * fMaxEntriesPerBin + (first + index) % fMaxEntriesPerBin];
+}
+
+//_________________________________________________________________________________________________
+TH1D *AliMixEventPool::CreateFillHistogram(const char *name) const
+{
+   //
+   // Histogram of the number of events added to each bin (caller owns it)
+   //
+   Int_t nBins = fListOfEntryList.GetEntriesFast();
+   TH1D *h = new TH1D(name, Form("Events per pool bin (%s);bin index;events", GetName()), nBins, 0.5, nBins + 0.5);
+   h->SetDirectory(0);
+   UpdateFillHistogram(h);
+   return h;
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventPool::UpdateFillHistogram(TH1D *h) const
+{
+   //
+   // Sets the contents of h (from CreateFillHistogram) to the number of events added to each bin
+   //
+   if (!h) return;
+   for (Int_t i = 0; i < h->GetNbinsX() && i < fNAdded.GetSize(); i++) h->SetBinContent(i + 1, fNAdded[i]);
 }
 
 //_________________________________________________________________________________________________
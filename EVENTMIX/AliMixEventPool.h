@@ -13,12 +13,18 @@
 
 #include <TObjArray.h>
 #include <TNamed.h>
+#include <TArrayI.h>
+#include <TArrayL64.h>
 
+class TH1D;
 class TEntryList;
 class AliMixEventCutObj;
 class AliVEvent;
 class AliMixEventPool : public TNamed {
 public:
+   // what happens to a new entry when the bin is full (see SetMaxEntriesPerBin)
+   enum EEvictionPolicy { kEvictOldest = 0, kKeepOldest = 1 };
+
    AliMixEventPool(const char *name = "mixEventPool", const char *title = "Mix event pool");
    AliMixEventPool(const AliMixEventPool &obj);
    AliMixEventPool &operator= (const AliMixEventPool &obj);
@@ -36,6 +42,17 @@ public:
 
    Bool_t      AddEntry(Long64_t entry, AliVEvent *ev);
    TEntryList *FindEntryList(AliVEvent *ev, Int_t &idEntryList);
+   Int_t       FindBin(AliVEvent *ev);
+
+   // entries held by a bin in the order they were added (idEntryList as returned by FindEntryList)
+   Long64_t    GetNEntries(Int_t idEntryList) const;
+   Long64_t    GetEntry(Int_t idEntryList, Long64_t index) const;
+   Bool_t      IsLastEntryStored() const { return fLastEntryStored; }
+   TH1D       *CreateFillHistogram(const char *name = "hMixPoolFill") const;
+   void        UpdateFillHistogram(TH1D *h) const;
+
+   void        SetMaxEntriesPerBin(Int_t maxEntries, EEvictionPolicy policy = kEvictOldest);
+   Int_t       GetMaxEntriesPerBin() const { return fMaxEntriesPerBin; }
 
    void        AddCut(AliMixEventCutObj *cut);
 
@@ -57,8 +74,18 @@ private:
    Int_t       fBinNumber;             // bin number
    Int_t       fBufferSize;            // buffer size
    Int_t       fMixNumber;             // mixing number
+   Int_t       fMaxEntriesPerBin;      // capacity of the entry ring of each bin (0: unlimited entry lists)
+   Int_t       fEvictionPolicy;        // EEvictionPolicy when a bin is full
+   Bool_t      fLastEntryStored;       //! the last AddEntry() stored its entry
+
+   TArrayI     fCutStride;             //! stride of each cut in the bin index
+   TArrayL64   fRingEntries;           //! entry rings of all bins (fMaxEntriesPerBin per bin)
+   TArrayL64   fRingN;                 //! number of entries added to the ring of each bin
+   TArrayL64   fNAdded;                //! number of entries added to each bin (also rejected ones)
+
+   void        InitBinning();
 
-   ClassDef(AliMixEventPool, 1)
+   ClassDef(AliMixEventPool, 3)
 };
 
 #endif
@@ -11,6 +11,7 @@
 #include <TChain.h>
 #include <TChainElement.h>
 #include <TSystem.h>
+#include <TMath.h>
 
 #include "AliLog.h"
 #include "AliAnalysisManager.h"
@@ -19,6 +20,7 @@
 #include "AliMixEventPool.h"
 #include "AliMixInputEventHandler.h"
 #include "AliMixInputHandlerInfo.h"
+#include "AliMixSlimEvent.h"
 
 #include "AliAnalysisTaskSE.h"
 
@@ -43,7 +45,13 @@ AliMixInputEventHandler::AliMixInputEventHandler(const Int_t size, const Int_t m
    fCurrentBinIndex(-1),
    fOfflineTriggerMask(0),
    fCurrentMixEntry(),
-   fCurrentEntryMainTree(0)
+   fCurrentEntryMainTree(0),
+   fSlimEventPrototype(0),
+   fSlimDepth(0),
+   fSlimEvents(),
+   fSlimNext(),
+   fSlimN(),
+   fSlimMixedEvent(0)
 {
    //
    // Default constructor.
@@ -59,6 +67,8 @@ AliMixInputEventHandler::~AliMixInputEventHandler() {
    // Destructor
    //
    fMixTrees.Clear();
+   fSlimEvents.Delete();
+   delete fSlimEventPrototype;
 }
 
 //_____________________________________________________________________________
@@ -144,6 +154,8 @@ Bool_t AliMixInputEventHandler::Notify(const char *path)
 
    // in case of local doPrepareEntry only first time
    if (anType.CompareTo("proof")) doPrepareEntry = (fMixIntupHandlerInfoTmp->GetChain()->GetEntries()<=0);
+   // slim events are kept in memory, mixed events are not read
+   if (fSlimEventPrototype) doPrepareEntry = kFALSE;
 
    // adds current file
    fMixIntupHandlerInfoTmp->AddTreeToChain(path);
@@ -195,6 +207,10 @@ Bool_t AliMixInputEventHandler::GetEntry()
    if (!fEventPool) {
       MixStd();
    }
+   // slim events in memory
+   else if (fSlimEventPrototype) {
+      MixSlim();
+   }
    // if buffer size is higher then 1
    else if (fBufferSize > 1) {
       MixBuffer();
@@ -320,7 +336,8 @@ Bool_t AliMixInputEventHandler::MixBuffer()
       UserExecMixAllTasks(fEntryCounter, -1, fEntryCounter, -1, 0);
       return kTRUE;
    } else {
-      elNum = el->GetN();
+      // the current event counts as the last entry also when the pool did not store it (full bin with kKeepOldest)
+      elNum = fEventPool->GetNEntries(idEntryList) + (fEventPool->IsLastEntryStored() ? 0 : 1);
       if (elNum < fBufferSize + 1) {
          UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, -1, 0);
          AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED (%lld) LESS THEN BUFFER +++++++++++++++++++", fEntryCounter, elNum));
@@ -339,7 +356,7 @@ Bool_t AliMixInputEventHandler::MixBuffer()
          if (elNum >= fBufferSize) {
             Long64_t entryInEntryList =  elNum - 2 - counter;
             if (entryInEntryList < 0) break;
-            entryMix = el->GetEntry(entryInEntryList);
+            entryMix = fEventPool->GetEntry(idEntryList, entryInEntryList);
          }
       }
       AliDebug(AliLog::kDebug + 5, Form("Handler[%d] entryMix %lld ", counter, entryMix));
@@ -426,7 +443,8 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
          return kTRUE;
       }
    } else {
-      elNum = el->GetN();
+      // the current event counts as the last entry also when the pool did not store it (full bin with kKeepOldest)
+      elNum = fEventPool->GetNEntries(idEntryList) + (fEventPool->IsLastEntryStored() ? 0 : 1);
       if (elNum < fBufferSize + 1) {
          if (fDoMixIfNotEnoughEvents) {
             // include main event in to counter in this case (so idEntryList>0)
@@ -462,7 +480,7 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
       Long64_t entryInEntryList =  elNum - 2 - counter;
       AliDebug(AliLog::kDebug + 3, Form("entryInEntryList=%lld", entryInEntryList));
       if (entryInEntryList < 0) break;
-      entryMix = el->GetEntry(entryInEntryList);
+      entryMix = fEventPool->GetEntry(idEntryList, entryInEntryList);
       AliDebug(AliLog::kDebug + 3, Form("entryMix=%lld", entryMix));
       if (entryMix < 0) break;
       entryMixReal = entryMix;
@@ -495,6 +513,92 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithBuffer()
    return kFALSE;
 }
 
+//_____________________________________________________________________________
+Bool_t AliMixInputEventHandler::MixSlim()
+{
+   //
+   // Mix with the slim events of the same pool bin kept in memory,
+   // newest first, then store the current event in the ring buffer
+   //
+   AliDebug(AliLog::kDebug + 5, "<-");
+   AliDebug(AliLog::kDebug + 1, "Mix method");
+   // get correct handler
+   AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+   AliMultiInputEventHandler *mh = dynamic_cast<AliMultiInputEventHandler *>(mgr->GetInputEventHandler());
+   AliInputEventHandler *inEvHMain = 0;
+   if (mh) inEvHMain = dynamic_cast<AliInputEventHandler *>(mh->GetFirstInputEventHandler());
+   else inEvHMain = dynamic_cast<AliInputEventHandler *>(mgr->GetInputEventHandler());
+   if (!inEvHMain) return kFALSE;
+
+   // check for PhysSelection
+   if (!IsEventCurrentSelected()) return kFALSE;
+
+   fCurrentMixEntry.Reset();
+   fSlimMixedEvent = 0;
+
+   // find out zero chain entries
+   Long64_t zeroChainEntries = fMixIntupHandlerInfoTmp->GetChain()->GetEntries() - inEvHMain->GetTree()->GetTree()->GetEntries();
+   // fill entry
+   Long64_t currentMainEntry = inEvHMain->GetTree()->GetTree()->GetReadEntry() + zeroChainEntries;
+   AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ BEGIN SETUP EVENT %lld (slim) +++++++++++++++++++", fEntryCounter));
+   // reset mix number
+   fNumberMixed = 0;
+   Int_t idEntryList = -1;
+   AliVEvent *ev = inEvHMain->GetEvent();
+   if (!fEventPool->FindEntryList(ev, idEntryList)) {
+      AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED (el null) +++++++++++++++++++", fEntryCounter));
+      UserExecMixAllTasks(fEntryCounter, -1, currentMainEntry, -1, 0);
+      return kTRUE;
+   }
+
+   // ring buffer of the pool bin
+   const Int_t bin = idEntryList - 1;
+   if (bin >= fSlimNext.GetSize()) {
+      Int_t nBins = TMath::Max(bin + 1, fEventPool->GetListOfEntryLists()->GetEntries());
+      fSlimNext.Set(nBins);
+      fSlimN.Set(nBins);
+   }
+   TObjArray *ring = (bin < fSlimEvents.GetSize()) ? (TObjArray *) fSlimEvents.UncheckedAt(bin) : 0;
+   if (!ring) {
+      ring = new TObjArray(fSlimDepth);
+      ring->SetOwner(kTRUE);
+      fSlimEvents.AddAtAndExpand(ring, bin);
+   }
+
+   const Int_t nStored = fSlimN[bin];
+   if (nStored == 0 || (nStored < fSlimDepth && !fDoMixIfNotEnoughEvents)) {
+      UserExecMixAllTasks(fEntryCounter, (nStored == 0 || fDoMixIfNotEnoughEvents) ? idEntryList : -1, currentMainEntry, -1, 0);
+      AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED (%d) NOT ENOUGH EVENTS TO MIX => NEED=%d +++++++++++++++++++", fEntryCounter, nStored, fSlimDepth));
+   } else {
+      for (Int_t i = 0; i < nStored; i++) {
+         Int_t slot = (fSlimNext[bin] - 1 - i + fSlimDepth) % fSlimDepth;
+         fSlimMixedEvent = (AliMixSlimEvent *) ring->At(slot);
+         fCurrentMixEntry.Reset();
+         fCurrentMixEntry.Enter(fSlimMixedEvent->GetEntry());
+         // runs UserExecMix for all tasks
+         fNumberMixed++;
+         UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, fSlimMixedEvent->GetEntry(), fNumberMixed);
+      }
+      fSlimMixedEvent = 0;
+   }
+
+   // store the current event in place of the oldest one
+   const Int_t slot = fSlimNext[bin];
+   AliMixSlimEvent *slim = (AliMixSlimEvent *) ring->At(slot);
+   if (!slim) {
+      slim = (AliMixSlimEvent *) fSlimEventPrototype->Clone();
+      ring->AddAt(slim, slot);
+   }
+   slim->Fill(ev, currentMainEntry);
+   fSlimNext[bin] = (slot + 1) % fSlimDepth;
+   if (fSlimN[bin] < fSlimDepth) fSlimN[bin]++;
+
+   AliDebug(AliLog::kDebug + 3, Form("fEntryCounter=%lld fMixEventNumber=%d", fEntryCounter, fNumberMixed));
+   AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld +++++++++++++++++++", fEntryCounter));
+   AliDebug(AliLog::kDebug + 5, "->");
+   return kTRUE;
+}
+
 //_____________________________________________________________________________
 Bool_t AliMixInputEventHandler::FinishEvent()
 {
@@ -565,6 +669,24 @@ void AliMixInputEventHandler::SetMixNumber(const Int_t mixNum)
    fMixNumber = mixNum;
 }
 
+//_____________________________________________________________________________
+void AliMixInputEventHandler::SetSlimEventMixing(AliMixSlimEvent *prototype, Int_t depth)
+{
+   //
+   // Mix with in-memory copies (clones of prototype, filled with
+   // AliMixSlimEvent::Fill) of the last 'depth' events of the same pool bin
+   // instead of re-reading them from the input. Default depth is the mix
+   // number. Tasks get the mixed event in UserExecMix with GetSlimMixedEvent().
+   // The handler takes ownership of the prototype.
+   //
+   if (fSlimEventPrototype && fSlimEventPrototype != prototype) delete fSlimEventPrototype;
+   fSlimEventPrototype = prototype;
+   fSlimDepth = (depth > 0) ? depth : TMath::Max(fMixNumber, 1);
+   fSlimEvents.Delete();
+   fSlimNext.Reset();
+   fSlimN.Reset();
+}
+
 //_____________________________________________________________________________
 Bool_t AliMixInputEventHandler::IsEventCurrentSelected()
 {
@@ -22,6 +22,7 @@ class TChain;
 class TChainElement;
 class AliMixEventPool;
 class AliMixInputHandlerInfo;
+class AliMixSlimEvent;
 class AliInputEventHandler;
 class AliMixInputEventHandler : public AliMultiInputEventHandler {
 
@@ -71,6 +72,11 @@ public:
 
    void                    DoMixEventGetEntryAuto(Bool_t doAuto=kTRUE) { fDoMixEventGetEntryAuto = doAuto; }
 
+   // mixing with in-memory snapshots of the last events of each pool bin (no re-reading of the input)
+   void                    SetSlimEventMixing(AliMixSlimEvent *prototype, Int_t depth = -1);
+   Bool_t                  IsSlimEventMixing() const { return (fSlimEventPrototype != 0); }
+   AliMixSlimEvent        *GetSlimMixedEvent() const { return fSlimMixedEvent; }
+
    Bool_t                  GetEntryMainEvent();
    Bool_t                  GetEntryMixedEvent(Int_t idHandler=0);
 protected:
@@ -100,17 +106,25 @@ private:
    TEntryList fCurrentMixEntry;    //! array of mix entries currently used (user should touch)
    Long64_t fCurrentEntryMainTree; //! current entry in current tree (main event)
 
+   AliMixSlimEvent *fSlimEventPrototype; // prototype of the slim events (slim mixing if set)
+   Int_t    fSlimDepth;            // number of slim events kept per pool bin
+   TObjArray fSlimEvents;          //! ring buffer of slim events for each pool bin
+   TArrayI  fSlimNext;             //! next slot of the ring buffer of each pool bin
+   TArrayI  fSlimN;                //! number of filled slots of each pool bin
+   AliMixSlimEvent *fSlimMixedEvent; //! slim event currently mixed
+
    virtual Bool_t          MixStd();
    virtual Bool_t          MixBuffer();
    virtual Bool_t          MixEventsMoreTimesWithOneEvent();
    virtual Bool_t          MixEventsMoreTimesWithBuffer();
+   virtual Bool_t          MixSlim();
 
    void                    UserExecMixAllTasks(Long64_t entryCounter, Int_t idEntryList, Long64_t entryMainReal, Long64_t entryMixReal, Int_t numMixed);
 
    AliMixInputEventHandler(const AliMixInputEventHandler &handler);
    AliMixInputEventHandler &operator=(const AliMixInputEventHandler &handler);
 
-   ClassDef(AliMixInputEventHandler, 5)
+   ClassDef(AliMixInputEventHandler, 6)
 };
 
 #endif
@@ -0,0 +1,115 @@
+//
+// Class AliMixSlimEvent
+//
+// Compact in-memory snapshot of an event used by AliMixInputEventHandler
+// to mix without re-reading the input
+//
+
+#include <TMath.h>
+
+#include "AliVEvent.h"
+#include "AliVParticle.h"
+#include "AliVVertex.h"
+
+#include "AliMixSlimEvent.h"
+
+ClassImp(AliMixSlimEvent)
+
+//_________________________________________________________________________________________________
+AliMixSlimEvent::AliMixSlimEvent(Int_t nUserColumns) : TObject(),
+   fEntry(-1),
+   fVertexZ(0),
+   fNTracks(0),
+   fNUserColumns(nUserColumns > 0 ? nUserColumns : 0),
+   fPt(),
+   fEta(),
+   fPhi(),
+   fCharge(),
+   fUserColumns()
+{
+   //
+   // Default constructor.
+   //
+}
+
+//_________________________________________________________________________________________________
+AliMixSlimEvent::AliMixSlimEvent(const AliMixSlimEvent &obj) : TObject(obj),
+   fEntry(obj.fEntry),
+   fVertexZ(obj.fVertexZ),
+   fNTracks(obj.fNTracks),
+   fNUserColumns(obj.fNUserColumns),
+   fPt(obj.fPt),
+   fEta(obj.fEta),
+   fPhi(obj.fPhi),
+   fCharge(obj.fCharge),
+   fUserColumns(obj.fUserColumns)
+{
+   //
+   // Copy constructor
+   //
+}
+
+//_________________________________________________________________________________________________
+AliMixSlimEvent &AliMixSlimEvent::operator=(const AliMixSlimEvent &obj)
+{
+   //
+   // Assigned operator
+   //
+   if (&obj != this) {
+      TObject::operator=(obj);
+      fEntry = obj.fEntry;
+      fVertexZ = obj.fVertexZ;
+      fNTracks = obj.fNTracks;
+      fNUserColumns = obj.fNUserColumns;
+      fPt = obj.fPt;
+      fEta = obj.fEta;
+      fPhi = obj.fPhi;
+      fCharge = obj.fCharge;
+      fUserColumns = obj.fUserColumns;
+   }
+   return *this;
+}
+
+//_________________________________________________________________________________________________
+void AliMixSlimEvent::Reset()
+{
+   //
+   // Removes all tracks (the arrays are kept for the next event)
+   //
+   fEntry = -1;
+   fVertexZ = 0;
+   fNTracks = 0;
+}
+
+//_________________________________________________________________________________________________
+void AliMixSlimEvent::Fill(AliVEvent *ev, Long64_t entry)
+{
+   //
+   // Stores the accepted tracks of event ev (entry in the full chain)
+   //
+   Reset();
+   if (!ev) return;
+   fEntry = entry;
+   const AliVVertex *vtx = ev->GetPrimaryVertex();
+   if (vtx) fVertexZ = vtx->GetZ();
+
+   const Int_t nTracks = ev->GetNumberOfTracks();
+   for (Int_t i = 0; i < nTracks; i++) {
+      AliVParticle *track = ev->GetTrack(i);
+      if (!track || !AcceptTrack(ev, track)) continue;
+      if (fNTracks >= fPt.GetSize()) {
+         Int_t size = TMath::Max(2 * fPt.GetSize(), 64);
+         fPt.Set(size);
+         fEta.Set(size);
+         fPhi.Set(size);
+         fCharge.Set(size);
+         if (fNUserColumns > 0) fUserColumns.Set(size * fNUserColumns);
+      }
+      fPt[fNTracks] = track->Pt();
+      fEta[fNTracks] = track->Eta();
+      fPhi[fNTracks] = track->Phi();
+      fCharge[fNTracks] = track->Charge();
+      if (fNUserColumns > 0) FillUserColumns(ev, track, fUserColumns.GetArray() + fNTracks * fNUserColumns);
+      fNTracks++;
+   }
+}
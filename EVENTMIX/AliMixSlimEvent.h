@@ -0,0 +1,60 @@
+//
+// Class AliMixSlimEvent
+//
+// Compact in-memory snapshot of an event used by AliMixInputEventHandler
+// to mix without re-reading the input (see SetSlimEventMixing).
+// Stores pt, eta, phi and charge of the accepted tracks and a number of
+// user columns per track. Derive from it and override AcceptTrack() and
+// FillUserColumns() to select the tracks and store e.g. PID information.
+//
+
+#ifndef ALIMIXSLIMEVENT_H
+#define ALIMIXSLIMEVENT_H
+
+#include <TObject.h>
+#include <TArrayF.h>
+#include <TArrayC.h>
+
+class AliVEvent;
+class AliVParticle;
+class AliMixSlimEvent : public TObject {
+
+public:
+   AliMixSlimEvent(Int_t nUserColumns = 0);
+   AliMixSlimEvent(const AliMixSlimEvent &obj);
+   AliMixSlimEvent &operator=(const AliMixSlimEvent &obj);
+   virtual ~AliMixSlimEvent() {}
+
+   // selection and user columns of the stored tracks
+   virtual Bool_t    AcceptTrack(AliVEvent * /*ev*/, AliVParticle * /*track*/) const { return kTRUE; }
+   virtual void      FillUserColumns(AliVEvent * /*ev*/, AliVParticle * /*track*/, Float_t * /*columns*/) const {}
+
+   void              Fill(AliVEvent *ev, Long64_t entry);
+   void              Reset();
+
+   Long64_t          GetEntry() const { return fEntry; }
+   Float_t           GetVertexZ() const { return fVertexZ; }
+   Int_t             GetNTracks() const { return fNTracks; }
+   Int_t             GetNUserColumns() const { return fNUserColumns; }
+   Float_t           GetPt(Int_t i) const { return fPt.At(i); }
+   Float_t           GetEta(Int_t i) const { return fEta.At(i); }
+   Float_t           GetPhi(Int_t i) const { return fPhi.At(i); }
+   Int_t             GetCharge(Int_t i) const { return fCharge.At(i); }
+   Float_t           GetUserColumn(Int_t i, Int_t col) const { return fUserColumns.At(i * fNUserColumns + col); }
+
+private:
+
+   Long64_t          fEntry;           // entry of the event in the full chain
+   Float_t           fVertexZ;         // z of the primary vertex
+   Int_t             fNTracks;         // number of stored tracks
+   Int_t             fNUserColumns;    // number of user columns per track
+   TArrayF           fPt;              // pt of the tracks
+   TArrayF           fEta;             // eta of the tracks
+   TArrayF           fPhi;             // phi of the tracks
+   TArrayC           fCharge;          // charge of the tracks
+   TArrayF           fUserColumns;     // user columns (track major)
+
+   ClassDef(AliMixSlimEvent, 1)
+};
+
+#endif
@@ -6,6 +6,7 @@
 #pragma link C++ class AliMixInfo+;
 #pragma link C++ class AliMixInputHandlerInfo+;
 #pragma link C++ class AliMixInputEventHandler+;
+#pragma link C++ class AliMixSlimEvent+;
 #pragma link C++ class AliAnalysisTaskMixInfo+;
 
 #endif
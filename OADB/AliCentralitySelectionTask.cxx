@@ -52,6 +52,7 @@
 #include "AliCentrality.h"
 #include "AliOADBCentrality.h"
 #include "AliOADBContainer.h"
+#include "AliOADBCache.h"
 #include "AliMultiplicity.h"
 #include "AliAODHandler.h"
 #include "AliAODHeader.h"
@@ -2008,14 +2009,15 @@ Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
   TString fileName =(Form("%s/COMMON/CENTRALITY/data/centrality.root", AliAnalysisManager::GetOADBPath()));
   AliInfo(Form("Setup Centrality Selection for run %d with file %s\n",fCurrentRun,fileName.Data()));
 
-  AliOADBContainer *con = new AliOADBContainer("OADB");
-  con->InitFromFile(fileName,"Centrality");
+  // the container is read once per process and shared (AliOADBCache), the objects are not modified
+  AliOADBCache *cache = AliOADBCache::Instance();
+  if (!cache->GetContainer(fileName,"Centrality")) AliFatal(Form("Cannot fetch OADB container for centrality from %s", fileName.Data()));
 
   AliOADBCentrality*  centOADB = 0;
-  centOADB = (AliOADBCentrality*)(con->GetObject(fCurrentRun));
+  centOADB = (AliOADBCentrality*)(cache->GetObject(fileName,"Centrality",fCurrentRun));
   if (!centOADB) {
     AliWarning(Form("Centrality OADB does not exist for run %d, using Default \n",fCurrentRun ));
-    centOADB  = (AliOADBCentrality*)(con->GetDefaultObject("oadbDefault"));
+    centOADB  = (AliOADBCentrality*)(cache->GetDefaultObject(fileName,"Centrality","oadbDefault"));
   }
 
   Bool_t isHijing=kFALSE;
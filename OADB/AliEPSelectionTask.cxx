@@ -55,6 +55,7 @@
 #include "AliBackgroundSelection.h"
 #include "AliESDUtils.h"
 #include "AliOADBContainer.h"
+#include "AliOADBCache.h"
 #include "AliAODMCHeader.h"
 #include "AliAODTrack.h"
 #include "AliVTrack.h"
@@ -180,15 +181,17 @@ AliEPSelectionTask::~AliEPSelectionTask()
       delete fESDtrackCuts;
       fESDtrackCuts = 0;
   }
-  if (fUserphidist) {
+  if (fUserphidist || fPeriod.CompareTo("LHC10h")==0) {
     if (fPhiDist[0]) {
       delete fPhiDist[0];
       fPhiDist[0] = 0;
     }
   }
-  if (fEPContainer){
-      delete fEPContainer;
-      fEPContainer = 0;
+  // the OADB containers belong to AliOADBCache
+  fEPContainer = 0;
+  if (fSparseDist) {
+      delete fSparseDist;
+      fSparseDist = 0;
   }
   if (fPeriod.CompareTo("LHC11h")==0){
       for(Int_t i = 0; i < 4; i++) {
@@ -199,12 +202,10 @@ AliEPSelectionTask::~AliEPSelectionTask()
       }
       if(fHruns) delete fHruns;
   }
-  if(fQDist[0] && fQDist[1]) {
-    for(Int_t i = 0; i < 2; i++) {
-      if(fQDist[i]){
-	delete fQDist[i];
-	fQDist[i] = 0;
-      }
+  for(Int_t i = 0; i < 2; i++) {
+    if(fQDist[i]){
+      delete fQDist[i];
+      fQDist[i] = 0;
     }
   }
 }
@@ -745,7 +746,13 @@ void AliEPSelectionTask::SetPhiDist()
 
     if (fPeriod.CompareTo("LHC10h")==0)
        {
-        fPhiDist[0] = (TH1F*) fEPContainer->GetObject(fRunNumber, "Default");}
+        // own copy : the container is shared (AliOADBCache) and the histogram may be rebinned below
+        if (fPhiDist[0]) delete fPhiDist[0];
+        fPhiDist[0] = (TH1F*) fEPContainer->GetObject(fRunNumber, "Default");
+        if (fPhiDist[0]) {
+          fPhiDist[0] = (TH1F*) fPhiDist[0]->Clone();
+          fPhiDist[0]->SetDirectory(0);
+        }}
         else if(fPeriod.CompareTo("LHC11h")==0){
             Int_t runbin=fHruns->FindBin(fRunNumber);
             if (fHruns->GetBinContent(runbin) > 1){
@@ -821,8 +828,17 @@ void AliEPSelectionTask::SetQvectorDist()
 {
   if(!fUseRecentering) return;
   AliInfo(Form("Setting q vector distributions"));
-  fQDist[0] = (TProfile*) fQxContainer->GetObject(fRunNumber, "Default");
-  fQDist[1] = (TProfile*) fQyContainer->GetObject(fRunNumber, "Default");
+  // own copies : the containers are shared (AliOADBCache) and the profiles may be rebinned below
+  TProfile* qDist[2] = {(TProfile*) fQxContainer->GetObject(fRunNumber, "Default"),
+                        (TProfile*) fQyContainer->GetObject(fRunNumber, "Default")};
+  for (Int_t i = 0; i < 2; i++) {
+    if (fQDist[i]) delete fQDist[i];
+    fQDist[i] = 0;
+    if (qDist[i]) {
+      fQDist[i] = (TProfile*) qDist[i]->Clone();
+      fQDist[i]->SetDirectory(0);
+    }
+  }
 
   if (!fQDist[0] || !fQDist[1]) {
     AliError(Form("Cannot find OADB q-vector distributions for run %d. Using default values (mean=0,rms=1).", fRunNumber));
@@ -918,13 +934,9 @@ void AliEPSelectionTask::SetOADBandPeriod()
            oadbfilename = (Form("%s/COMMON/EVENTPLANE/data/epphidist.root", AliAnalysisManager::GetOADBPath()));
            }
 
-       TFile foadb(oadbfilename);
-       if(!foadb.IsOpen()) AliFatal(Form("Cannot open OADB file %s", oadbfilename.Data()));
-
        AliInfo("Using Standard OADB");
-       fEPContainer = (AliOADBContainer*) foadb.Get("epphidist");
-       if (!fEPContainer) AliFatal("Cannot fetch OADB container for EP selection");
-       foadb.Close();
+       fEPContainer = AliOADBCache::Instance()->GetContainer(oadbfilename,"epphidist");
+       if (!fEPContainer) AliFatal(Form("Cannot fetch OADB container for EP selection from %s", oadbfilename.Data()));
        }
      }
 
@@ -934,13 +946,12 @@ void AliEPSelectionTask::SetOADBandPeriod()
       // if it's already set and custom class is required, we use the one provided by the user
 
       oadbfilename = (Form("%s/COMMON/EVENTPLANE/data/epphidist2011.root", AliAnalysisManager::GetOADBPath()));
-      TFile *foadb = TFile::Open(oadbfilename);
-      if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", oadbfilename.Data()));
-
       AliInfo("Using Standard OADB");
-      fSparseDist = (THnSparse*) foadb->Get("Default");
-      if (!fSparseDist) AliFatal("Cannot fetch OADB container for EP selection");
-      foadb->Close();
+      if (!fSparseDist) { // own copy : the axis ranges are changed in SetPhiDist() (and reset at the end)
+        THnSparse *sparseDist = (THnSparse*) AliOADBCache::Instance()->GetFileObject(oadbfilename,"Default");
+        if (!sparseDist) AliFatal(Form("Cannot fetch OADB container for EP selection from %s", oadbfilename.Data()));
+        fSparseDist = (THnSparse*) sparseDist->Clone();
+      }
       if(!fHruns){
            fHruns = (TH1F*)fSparseDist->Projection(0); //projection on run axis;
            fHruns->SetName("runsHisto");
@@ -949,14 +960,10 @@ void AliEPSelectionTask::SetOADBandPeriod()
 
       if(fUseRecentering) {
 	oadbfilename = (Form("%s/COMMON/EVENTPLANE/data/eprecentering.root", AliAnalysisManager::GetOADBPath()));
-	TFile *foadb = TFile::Open(oadbfilename);
-	if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", oadbfilename.Data()));
-
 	AliInfo("Using Standard OADB");
-	fQxContainer = (AliOADBContainer*) foadb->Get("eprecentering.Qx");
-	fQyContainer = (AliOADBContainer*) foadb->Get("eprecentering.Qy");
-	if (!fQxContainer || !fQyContainer) AliFatal("Cannot fetch OADB container for EP recentering");
-	foadb->Close();
+	fQxContainer = AliOADBCache::Instance()->GetContainer(oadbfilename,"eprecentering.Qx");
+	fQyContainer = AliOADBCache::Instance()->GetContainer(oadbfilename,"eprecentering.Qy");
+	if (!fQxContainer || !fQyContainer) AliFatal(Form("Cannot fetch OADB container for EP recentering from %s", oadbfilename.Data()));
       }
 
      }
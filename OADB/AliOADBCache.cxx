@@ -0,0 +1,175 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-------------------------------------------------------------------------
+//     Process-wide cache of OADB/calibration objects read from files
+//-------------------------------------------------------------------------
+
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TH1.h>
+#include <TStopwatch.h>
+#include <TSystem.h>
+#include "AliOADBContainer.h"
+#include "AliOADBCache.h"
+#include "AliLog.h"
+
+ClassImp(AliOADBCache);
+
+AliOADBCache* AliOADBCache::fgInstance = 0;
+
+//______________________________________________________________________________
+AliOADBCache::AliOADBCache() :
+  TObject(),
+  fFiles(),
+  fObjects(),
+  fRunObjects(),
+  fNHits(0),
+  fNMisses(0),
+  fNFilesOpened(0),
+  fLoadTime(0)
+{
+  // Default constructor
+}
+
+//______________________________________________________________________________
+AliOADBCache::~AliOADBCache()
+{
+  // Destructor
+  Clear();
+  if (fgInstance == this) fgInstance = 0;
+}
+
+//______________________________________________________________________________
+AliOADBCache* AliOADBCache::Instance()
+{
+  // Return the cache, created at the first call
+  if (!fgInstance) fgInstance = new AliOADBCache();
+  return fgInstance;
+}
+
+//______________________________________________________________________________
+void AliOADBCache::Clear(Option_t* /*opt*/)
+{
+  // Delete all cached objects and close the files.
+  // Pointers handed out before are invalid afterwards.
+  fRunObjects.clear();
+  for (std::map<std::string,TObject*>::iterator it = fObjects.begin(); it != fObjects.end(); ++it) delete it->second;
+  fObjects.clear();
+  for (std::map<std::string,TFile*>::iterator it = fFiles.begin(); it != fFiles.end(); ++it) {
+    if (!it->second) continue;
+    it->second->Close();
+    delete it->second;
+  }
+  fFiles.clear();
+}
+
+//______________________________________________________________________________
+TFile* AliOADBCache::OpenFile(const TString& fileName)
+{
+  // Return the file, opened at the first call
+  std::map<std::string,TFile*>::const_iterator it = fFiles.find(fileName.Data());
+  if (it != fFiles.end()) return it->second;
+
+  TDirectory::TContext context;  // TFile::Open changes gDirectory
+  TFile* file = TFile::Open(fileName);
+  if (!file || !file->IsOpen()) {
+    AliError(Form("Cannot open file %s", fileName.Data()));
+    delete file;
+    file = 0;
+  } else {
+    fNFilesOpened++;
+  }
+  fFiles[fileName.Data()] = file;
+  return file;
+}
+
+//______________________________________________________________________________
+TObject* AliOADBCache::GetFileObject(const char* fileName, const char* objectName)
+{
+  // Return the object objectName of file fileName (environment variables are expanded),
+  // read at the first call. Histograms are not attached to any directory.
+  TString name(fileName);
+  gSystem->ExpandPathName(name);
+  std::string key = Form("%s#%s", name.Data(), objectName);
+  std::map<std::string,TObject*>::const_iterator it = fObjects.find(key);
+  if (it != fObjects.end()) {
+    fNHits++;
+    return it->second;
+  }
+
+  fNMisses++;
+  TStopwatch timer;
+  TObject* obj = 0;
+  TFile* file = OpenFile(name);
+  if (file) {
+    Bool_t addStatus = TH1::AddDirectoryStatus();
+    TH1::AddDirectory(kFALSE);
+    obj = file->Get(objectName);
+    TH1::AddDirectory(addStatus);
+    if (!obj) AliError(Form("Cannot find %s in %s", objectName, name.Data()));
+  }
+  fLoadTime += timer.RealTime();
+  fObjects[key] = obj;
+  return obj;
+}
+
+//______________________________________________________________________________
+AliOADBContainer* AliOADBCache::GetContainer(const char* fileName, const char* containerName)
+{
+  // Return the OADB container containerName of file fileName
+  TObject* obj = GetFileObject(fileName, containerName);
+  if (obj && !obj->InheritsFrom(AliOADBContainer::Class())) {
+    AliError(Form("%s in %s is a %s, not an OADB container", containerName, fileName, obj->ClassName()));
+    return 0;
+  }
+  return (AliOADBContainer*) obj;
+}
+
+//______________________________________________________________________________
+TObject* AliOADBCache::GetObject(const char* fileName, const char* containerName, Int_t run, const char* def, const char* passName)
+{
+  // Return the object of the container valid for run (see AliOADBContainer::GetObject).
+  // The result of each lookup is remembered, also when nothing is found.
+  std::string key = Form("%s#%s#%d#%s#%s", fileName, containerName, run, def, passName);
+  std::map<std::string,TObject*>::const_iterator it = fRunObjects.find(key);
+  if (it != fRunObjects.end()) {
+    fNHits++;
+    return it->second;
+  }
+
+  AliOADBContainer* container = GetContainer(fileName, containerName);
+  fNMisses++;
+  TObject* obj = container ? container->GetObject(run, def, passName) : 0;
+  fRunObjects[key] = obj;
+  return obj;
+}
+
+//______________________________________________________________________________
+TObject* AliOADBCache::GetDefaultObject(const char* fileName, const char* containerName, const char* def)
+{
+  // Return the default object def of the container
+  AliOADBContainer* container = GetContainer(fileName, containerName);
+  return container ? container->GetDefaultObject(def) : 0;
+}
+
+//______________________________________________________________________________
+void AliOADBCache::Print(Option_t* /*opt*/) const
+{
+  // Print the cache statistics
+  Printf("AliOADBCache: %d files opened, %d objects read, %d run lookups cached",
+         fNFilesOpened, (Int_t) fObjects.size(), (Int_t) fRunObjects.size());
+  Printf("              %lld hits, %lld misses, %.3f s spent reading files", fNHits, fNMisses, fLoadTime);
+}
@@ -0,0 +1,65 @@
+#ifndef ALIOADBCACHE_H
+#define ALIOADBCACHE_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+
+//-------------------------------------------------------------------------
+//     Process-wide cache of OADB/calibration objects read from files
+//
+//     Each file is opened once and each object (e.g. an AliOADBContainer)
+//     is read once per process. The lookups of run dependent objects in a
+//     container are remembered per (file, container, run, default, pass).
+//     All returned objects are owned by the cache and shared between the
+//     users : they must neither be modified nor deleted (Clone() them if
+//     needed).
+//-------------------------------------------------------------------------
+
+#include <map>
+#include <string>
+#include <TObject.h>
+#include <TString.h>
+
+class TFile;
+class AliOADBContainer;
+
+class AliOADBCache : public TObject
+{
+ public :
+  static AliOADBCache* Instance();
+  virtual ~AliOADBCache();
+  //
+  TObject*          GetFileObject(const char* fileName, const char* objectName);
+  AliOADBContainer* GetContainer(const char* fileName, const char* containerName);
+  TObject*          GetObject(const char* fileName, const char* containerName, Int_t run, const char* def = "", const char* passName = "");
+  TObject*          GetDefaultObject(const char* fileName, const char* containerName, const char* def);
+  //
+  Long64_t          GetNHits()        const {return fNHits;}
+  Long64_t          GetNMisses()      const {return fNMisses;}
+  Int_t             GetNFilesOpened() const {return fNFilesOpened;}
+  Double_t          GetLoadTime()     const {return fLoadTime;}
+  //
+  virtual void      Clear(Option_t* opt = "");
+  virtual void      Print(Option_t* opt = "") const;
+  //
+ private:
+  AliOADBCache();
+  AliOADBCache(const AliOADBCache& cache);
+  AliOADBCache& operator=(const AliOADBCache& cache);
+  //
+  TFile*            OpenFile(const TString& fileName);
+  //
+  static AliOADBCache* fgInstance;            // the cache
+  //
+  std::map<std::string,TFile*>   fFiles;      //! open files (0: could not be opened)
+  std::map<std::string,TObject*> fObjects;    //! objects read from the files, by file and name (0: not found)
+  std::map<std::string,TObject*> fRunObjects; //! objects found in the containers, by file, container, run, default and pass
+  Long64_t          fNHits;                   // lookups answered from the cache
+  Long64_t          fNMisses;                 // lookups which needed a file or container access
+  Int_t             fNFilesOpened;            // number of files opened
+  Double_t          fLoadTime;                // time spent opening files and reading objects (s)
+  //
+  ClassDef(AliOADBCache, 0);
+};
+
+#endif
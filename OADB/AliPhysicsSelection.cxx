@@ -65,6 +65,10 @@
 //   Origin: Jan Fiete Grosse-Oetringhaus, CERN 
 //           Michele Floris, CERN
 //-------------------------------------------------------------------------
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 #include <vector>
 
 #include <Riostream.h>
@@ -95,7 +99,7 @@
 #include "AliAnalysisManager.h"
 #include "TPRegexp.h"
 #include "TFile.h"
-#include "AliOADBContainer.h"
+#include "AliOADBCache.h"
 #include "AliOADBPhysicsSelection.h"
 #include "AliOADBFillingScheme.h"
 #include "AliOADBTriggerAnalysis.h"
@@ -132,6 +136,12 @@ fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
 fTriggerToFormula(new StringToFormula()),
+fTriggerToProgram(new StringToProgram()),
+fOnlinePrograms(),
+fOfflinePrograms(),
+fTriggerBitValue(2*AliTriggerAnalysis::kStartOfFlags, 0),
+fTriggerBitEvent(2*AliTriggerAnalysis::kStartOfFlags, 0),
+fEventStamp(0),
 fTriggerToRegexp(new StringToRegexp())
 {
   // constructor
@@ -162,6 +172,12 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fFillOADB(0),
  fTriggerOADB(0),
  fTriggerToFormula(new StringToFormula()),
+ fTriggerToProgram(new StringToProgram()),
+ fOnlinePrograms(),
+ fOfflinePrograms(),
+ fTriggerBitValue(2*AliTriggerAnalysis::kStartOfFlags, 0),
+ fTriggerBitEvent(2*AliTriggerAnalysis::kStartOfFlags, 0),
+ fEventStamp(0),
  fTriggerToRegexp(new StringToRegexp())
  {
    // constructor
@@ -178,6 +194,7 @@ AliPhysicsSelection::~AliPhysicsSelection(){
   if (fFillOADB)     delete fFillOADB;
   if (fTriggerOADB)  delete fTriggerOADB;
   delete fTriggerToFormula;
+  delete fTriggerToProgram;
   delete fTriggerToRegexp;
 }
 
@@ -270,6 +287,66 @@ UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char
 Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
 						 AliTriggerAnalysis* triggerAnalysis,
 						 const char* triggerLogic, Bool_t offline){
+  return EvaluateTriggerProgram(event, triggerAnalysis, FindProgram(triggerLogic), offline);
+}
+
+/// Evaluate a compiled trigger logic (see FindProgram)
+///
+/// Each trigger bit is evaluated at most once per event (see EvaluateTriggerBit),
+/// the right operand of && and || only if needed.
+Bool_t AliPhysicsSelection::EvaluateTriggerProgram(const AliVEvent* event,
+						   AliTriggerAnalysis* triggerAnalysis,
+						   const TriggerLogicProgram& program, Bool_t offline){
+  if (!program.fCompiled) return EvaluateTriggerFormula(event, triggerAnalysis, program.fLogic.c_str(), offline);
+
+  typedef TriggerLogicProgram P;
+  Double_t stack[32]; // programs are compiled with fMaxDepth <= 32
+  Int_t top = -1;
+  const Int_t n = program.fCode.size();
+  for (Int_t pc = 0; pc < n; ++pc) {
+    const P::Instr& instr = program.fCode[pc];
+    switch (instr.fOp) {
+      case P::kPushBit:     stack[++top] = EvaluateTriggerBit(event, triggerAnalysis, instr.fArg, offline); break;
+      case P::kPushConst:   stack[++top] = instr.fValue; break;
+      case P::kNot:         stack[top] = !stack[top]; break;
+      case P::kNeg:         stack[top] = -stack[top]; break;
+      case P::kMul:         --top; stack[top] = stack[top] *  stack[top+1]; break;
+      case P::kDiv:         --top; stack[top] = stack[top] /  stack[top+1]; break;
+      case P::kAdd:         --top; stack[top] = stack[top] +  stack[top+1]; break;
+      case P::kSub:         --top; stack[top] = stack[top] -  stack[top+1]; break;
+      case P::kLess:        --top; stack[top] = stack[top] <  stack[top+1]; break;
+      case P::kGreater:     --top; stack[top] = stack[top] >  stack[top+1]; break;
+      case P::kLessEq:      --top; stack[top] = stack[top] <= stack[top+1]; break;
+      case P::kGreaterEq:   --top; stack[top] = stack[top] >= stack[top+1]; break;
+      case P::kEq:          --top; stack[top] = stack[top] == stack[top+1]; break;
+      case P::kNotEq:       --top; stack[top] = stack[top] != stack[top+1]; break;
+      case P::kJumpIfFalse: if (!stack[top]) { stack[top] = 0; pc = instr.fArg - 1; } else --top; break;
+      case P::kJumpIfTrue:  if (stack[top])  { stack[top] = 1; pc = instr.fArg - 1; } else --top; break;
+      case P::kBool:        stack[top] = (stack[top] != 0); break;
+    }
+  }
+  return stack[0];
+}
+
+/// Evaluate a trigger bit of AliTriggerAnalysis, remembering the result for the current event.
+/// The AliTriggerAnalysis objects of the different trigger classes are configured identically
+/// and EvaluateTrigger does not fill histograms, so the value can be shared between them.
+Int_t AliPhysicsSelection::EvaluateTriggerBit(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis,
+					      Int_t bit, Bool_t offline){
+  Int_t index = offline ? bit + AliTriggerAnalysis::kStartOfFlags : bit;
+  if (fTriggerBitEvent[index] != fEventStamp) {
+    typedef AliTriggerAnalysis::Trigger Trigger;
+    Trigger trigger = static_cast<Trigger>(offline ? (bit | AliTriggerAnalysis::kOfflineFlag) : bit);
+    fTriggerBitValue[index] = triggerAnalysis->EvaluateTrigger(event, trigger);
+    fTriggerBitEvent[index] = fEventStamp;
+  }
+  return fTriggerBitValue[index];
+}
+
+/// Evaluate a trigger logic with TFormula; used for the logics FindProgram cannot compile
+Bool_t AliPhysicsSelection::EvaluateTriggerFormula(const AliVEvent* event,
+						   AliTriggerAnalysis* triggerAnalysis,
+						   const char* triggerLogic, Bool_t offline){
   auto& formula_and_bits = FindForumla(triggerLogic);
   auto& trg_formula = formula_and_bits.first;
   auto& bits = formula_and_bits.second;
@@ -301,6 +378,13 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
   } else {
     if (eventType != 7) return kFALSE;
   }
+
+  // new event: invalidate the trigger bits evaluated so far
+  if (++fEventStamp == 0) {
+    std::fill(fTriggerBitEvent.begin(), fTriggerBitEvent.end(), 0);
+    fEventStamp = 1;
+  }
+  const Int_t nLogics = fOnlinePrograms.size();
   
   UInt_t accept = 0;
   Int_t nColl = fCollTrigClasses.GetEntries();
@@ -315,8 +399,12 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     Int_t triggerLogic = 0;
     UInt_t singleTriggerResult = CheckTriggerClass(event, triggerClass, triggerLogic);
     if (!singleTriggerResult) continue;
-    Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
-    Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
+    Bool_t onlineDecision  = (triggerLogic >= 0 && triggerLogic < nLogics) ?
+      EvaluateTriggerProgram(event, triggerAnalysis, *fOnlinePrograms[triggerLogic], kFALSE) :
+      EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
+    Bool_t offlineDecision = (triggerLogic >= 0 && triggerLogic < nLogics) ?
+      EvaluateTriggerProgram(event, triggerAnalysis, *fOfflinePrograms[triggerLogic], kTRUE) :
+      EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
     triggerAnalysis->FillHistograms(event,onlineDecision,offlineDecision);
     if (!onlineDecision) continue;
     if (!offlineDecision) continue;
@@ -358,35 +446,45 @@ Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
   Bool_t oldStatus = TH1::AddDirectoryStatus();
   TH1::AddDirectory(kFALSE);
   
-  /// Open OADB file and fetch OADB objects
+  /// Fetch OADB objects from the process-wide cache. The cached objects are shared
+  /// with other users, so we keep our own copies (deleted in the destructor)
   TString oadbfilename = AliPhysicsSelection::GetOADBFileName();
-  
-  TFile * foadb = TFile::Open(oadbfilename);
-  if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", oadbfilename.Data()));
+  AliOADBCache * oadbCache = AliOADBCache::Instance();
   
   if(!fPSOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
     AliInfo("Using Standard OADB");
-    AliOADBContainer * psContainer = (AliOADBContainer*) foadb->Get("physSel");
-    if (!psContainer) AliFatal("Cannot fetch OADB container for Physics selection");
-    fPSOADB = (AliOADBPhysicsSelection*) psContainer->GetObject(runNumber, fIsPP ? "oadbDefaultPP" : "oadbDefaultPbPb",fPassName);
-    if (!fPSOADB) AliFatal(Form("Cannot find physics selection object for run %d", runNumber));
+    if (!oadbCache->GetContainer(oadbfilename,"physSel")) AliFatal(Form("Cannot fetch OADB container for Physics selection from %s", oadbfilename.Data()));
+    TObject * psObject = oadbCache->GetObject(oadbfilename,"physSel",runNumber, fIsPP ? "oadbDefaultPP" : "oadbDefaultPbPb",fPassName);
+    if (!psObject) AliFatal(Form("Cannot find physics selection object for run %d", runNumber));
+    if (fPSOADB) delete fPSOADB;
+    fPSOADB = (AliOADBPhysicsSelection*) psObject->Clone();
   } else {
     AliInfo("Using Custom OADB");
   }
   if(!fFillOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
-    AliOADBContainer * fillContainer = (AliOADBContainer*) foadb->Get("fillScheme");
-    if (!fillContainer) AliFatal("Cannot fetch OADB container for filling scheme");
-    fFillOADB = (AliOADBFillingScheme*) fillContainer->GetObject(runNumber, "Default",fPassName);
-    if (!fFillOADB) AliFatal(Form("Cannot find  filling scheme object for run %d", runNumber));
+    if (!oadbCache->GetContainer(oadbfilename,"fillScheme")) AliFatal(Form("Cannot fetch OADB container for filling scheme from %s", oadbfilename.Data()));
+    TObject * fillObject = oadbCache->GetObject(oadbfilename,"fillScheme",runNumber, "Default",fPassName);
+    if (!fillObject) AliFatal(Form("Cannot find  filling scheme object for run %d", runNumber));
+    if (fFillOADB) delete fFillOADB;
+    fFillOADB = (AliOADBFillingScheme*) fillObject->Clone();
   }
   if(!fTriggerOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
-    AliOADBContainer * triggerContainer = (AliOADBContainer*) foadb->Get("trigAnalysis");
-    if (!triggerContainer) AliFatal("Cannot fetch OADB container for trigger analysis");
-    fTriggerOADB = (AliOADBTriggerAnalysis*) triggerContainer->GetObject(runNumber, "Default",fPassName);
-    if (!fTriggerOADB) AliFatal(Form("Cannot find  trigger analysis object for run %d", runNumber));
+    if (!oadbCache->GetContainer(oadbfilename,"trigAnalysis")) AliFatal(Form("Cannot fetch OADB container for trigger analysis from %s", oadbfilename.Data()));
+    TObject * triggerObject = oadbCache->GetObject(oadbfilename,"trigAnalysis",runNumber, "Default",fPassName);
+    if (!triggerObject) AliFatal(Form("Cannot find  trigger analysis object for run %d", runNumber));
+    if (fTriggerOADB) delete fTriggerOADB;
+    fTriggerOADB = (AliOADBTriggerAnalysis*) triggerObject->Clone(); // modified below with the OCDB thresholds
     fTriggerOADB->Print();
   }
   
+  // compile the trigger logics of this run once, the events only look them up by index
+  fOnlinePrograms.resize(NTRIGGERLOGICS);
+  fOfflinePrograms.resize(NTRIGGERLOGICS);
+  for (Int_t i = 0; i < NTRIGGERLOGICS; i++) {
+    fOnlinePrograms[i]  = &FindProgram(fPSOADB->GetHardwareTrigger(i));
+    fOfflinePrograms[i] = &FindProgram(fPSOADB->GetOfflineTrigger(i));
+  }
+
   if (fMC) {
     // override BX options in case of MC
     fUseBXNumbers = kFALSE;
@@ -875,6 +973,141 @@ FormulaAndBits& AliPhysicsSelection::FindForumla(const char* triggerLogic) {
   return it->second;
 }
 
+const TriggerLogicProgram& AliPhysicsSelection::FindProgram(const char* triggerLogic) {
+  // Do we have this logic compiled? If not, compile it into a postfix program:
+  //   or  := and { "||" and }     and := eq { "&&" eq }     eq  := rel { ("=="|"!=") rel }
+  //   rel := add { ("<"|">"|"<="|">=") add }     add := mul { ("+"|"-") mul }
+  //   mul := un { ("*"|"/") un }   un  := ("!"|"-") un | primary
+  //   primary := number | trigger name | "(" or ")"
+  // Anything else (e.g. bitwise operators) leaves the logic to the TFormula
+  auto it = fTriggerToProgram->find(triggerLogic);
+  if (it != fTriggerToProgram->end())
+    return it->second;
+
+  typedef TriggerLogicProgram P;
+  struct Compiler {
+    const char* fPos;
+    P& fProg;
+    Int_t fDepth;
+    Bool_t fOk;
+    Compiler(const char* logic, P& prog) : fPos(logic), fProg(prog), fDepth(0), fOk(kTRUE) {}
+
+    void Emit(Int_t op, Int_t arg = 0, Double_t value = 0) {
+      P::Instr instr = {op, arg, value};
+      fProg.fCode.push_back(instr);
+      if (op == P::kPushBit || op == P::kPushConst) {
+        if (++fDepth > fProg.fMaxDepth) fProg.fMaxDepth = fDepth;
+      } else if (op >= P::kMul && op <= P::kNotEq) {
+        fDepth--;
+      }
+    }
+    Bool_t Accept(const char* token) {
+      while (*fPos == ' ' || *fPos == '\t') fPos++;
+      size_t len = strlen(token);
+      if (strncmp(fPos, token, len)) return kFALSE;
+      // don't take the first character of "&&", "||", "<=", ">=", "==" or "!=" for a single character operator
+      if (len == 1 && fPos[1] && strchr("&|=", fPos[1]) && strchr("&|<>=!", fPos[0])) return kFALSE;
+      fPos += len;
+      return kTRUE;
+    }
+    void Or() {
+      And();
+      while (fOk && Accept("||")) Logical(P::kJumpIfTrue, &Compiler::And);
+    }
+    void And() {
+      Eq();
+      while (fOk && Accept("&&")) Logical(P::kJumpIfFalse, &Compiler::Eq);
+    }
+    void Logical(Int_t jump, void (Compiler::*operand)()) {
+      Int_t jumpPos = fProg.fCode.size();
+      Emit(jump);
+      fDepth--;          // the left operand is popped if the right one is evaluated
+      (this->*operand)();
+      Emit(P::kBool);
+      fProg.fCode[jumpPos].fArg = fProg.fCode.size();
+    }
+    void Eq() {
+      Rel();
+      while (fOk) {
+        if (Accept("==")) { Rel(); Emit(P::kEq); }
+        else if (Accept("!=")) { Rel(); Emit(P::kNotEq); }
+        else break;
+      }
+    }
+    void Rel() {
+      Add();
+      while (fOk) {
+        if (Accept("<=")) { Add(); Emit(P::kLessEq); }
+        else if (Accept(">=")) { Add(); Emit(P::kGreaterEq); }
+        else if (Accept("<")) { Add(); Emit(P::kLess); }
+        else if (Accept(">")) { Add(); Emit(P::kGreater); }
+        else break;
+      }
+    }
+    void Add() {
+      Mul();
+      while (fOk) {
+        if (Accept("+")) { Mul(); Emit(P::kAdd); }
+        else if (Accept("-")) { Mul(); Emit(P::kSub); }
+        else break;
+      }
+    }
+    void Mul() {
+      Unary();
+      while (fOk) {
+        if (Accept("*")) { Unary(); Emit(P::kMul); }
+        else if (Accept("/")) { Unary(); Emit(P::kDiv); }
+        else break;
+      }
+    }
+    void Unary() {
+      if (Accept("!")) { Unary(); Emit(P::kNot); return; }
+      if (Accept("-")) { Unary(); Emit(P::kNeg); return; }
+      Primary();
+    }
+    void Primary() {
+      while (*fPos == ' ' || *fPos == '\t') fPos++;
+      if (Accept("(")) {
+        Or();
+        if (fOk && !Accept(")")) fOk = kFALSE;
+        return;
+      }
+      if (isdigit(*fPos) || *fPos == '.') {
+        char* end = 0;
+        Double_t value = strtod(fPos, &end);
+        if (end == fPos) { fOk = kFALSE; return; }
+        fPos = end;
+        Emit(P::kPushConst, 0, value);
+        return;
+      }
+      if (isalpha(*fPos)) {
+        const char* begin = fPos;
+        while (isalnum(*fPos)) fPos++;
+        std::string name(begin, fPos);
+        TInterpreter::EErrorCode error;
+        Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", name.c_str()), &error);
+        if (error > 0 || bit <= 0 || bit >= AliTriggerAnalysis::kStartOfFlags) { fOk = kFALSE; return; }
+        Emit(P::kPushBit, bit);
+        return;
+      }
+      fOk = kFALSE;
+    }
+  };
+
+  P& program = (*fTriggerToProgram)[triggerLogic];
+  program.fLogic = triggerLogic;
+  program.fMaxDepth = 0;
+  Compiler compiler(triggerLogic, program);
+  compiler.Or();
+  while (*compiler.fPos == ' ' || *compiler.fPos == '\t') compiler.fPos++;
+  program.fCompiled = compiler.fOk && !*compiler.fPos && !program.fCode.empty() && program.fMaxDepth <= 32;
+  if (!program.fCompiled) {
+    if (*triggerLogic) AliInfo(Form("Trigger logic \"%s\" is evaluated with TFormula", triggerLogic));
+    program.fCode.clear();
+  }
+  return program;
+}
+
 TPRegexp& AliPhysicsSelection::FindRegexp(const std::string& triggers) const {
   auto it = fTriggerToRegexp->find(triggers);
   if (it != fTriggerToRegexp->end())
@@ -49,6 +49,20 @@ class StringToRegexp;
 typedef std::pair<R5TFormula, std::vector<AliTriggerAnalysis::Trigger>> FormulaAndBits;
 typedef std::map<std::string, FormulaAndBits> StringToFormula;
 
+// Trigger logic compiled into a postfix program over the AliTriggerAnalysis bits.
+// && and || are evaluated lazily; logics which cannot be compiled (fCompiled == kFALSE)
+// are evaluated with the TFormula
+struct TriggerLogicProgram {
+  enum EOp { kPushBit, kPushConst, kNot, kNeg, kMul, kDiv, kAdd, kSub, kLess, kGreater, kLessEq, kGreaterEq,
+             kEq, kNotEq, kJumpIfFalse, kJumpIfTrue, kBool };
+  struct Instr { Int_t fOp; Int_t fArg; Double_t fValue; }; // fArg: bit or jump target, fValue: constant
+  std::vector<Instr> fCode;
+  Int_t  fMaxDepth;
+  Bool_t fCompiled;
+  std::string fLogic;
+};
+typedef std::map<std::string, TriggerLogicProgram> StringToProgram;
+
 class AliPhysicsSelection : public AliAnalysisCuts{
 public:
   // These enums are deprecated
@@ -102,6 +116,9 @@ public:
 protected:
   UInt_t CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const;
   Bool_t EvaluateTriggerLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, const char* triggerLogic, Bool_t offline);
+  Bool_t EvaluateTriggerProgram(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, const TriggerLogicProgram& program, Bool_t offline);
+  Bool_t EvaluateTriggerFormula(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, const char* triggerLogic, Bool_t offline);
+  Int_t  EvaluateTriggerBit(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, Int_t bit, Bool_t offline);
   const char * GetTriggerString(TObjString * obj);
 
   TString fPassName;          // pass name for current run
@@ -125,10 +142,18 @@ protected:
   StringToFormula *fTriggerToFormula; //! Map trigger strings to TFormulas
   FormulaAndBits& FindForumla(const char* triggerLogic); //! Returns pair of TFormula and trigger bits
 
+  StringToProgram *fTriggerToProgram; //! Map trigger strings to compiled programs
+  const TriggerLogicProgram& FindProgram(const char* triggerLogic); //! Returns the compiled trigger logic
+  std::vector<const TriggerLogicProgram*> fOnlinePrograms;  //! online trigger logics of fPSOADB, by trigger logic index
+  std::vector<const TriggerLogicProgram*> fOfflinePrograms; //! offline trigger logics of fPSOADB, by trigger logic index
+  std::vector<Int_t>  fTriggerBitValue;                     //! trigger bits evaluated in the current event (online, offline)
+  std::vector<UInt_t> fTriggerBitEvent;                     //! event stamp at which the bits were evaluated
+  UInt_t fEventStamp;                                       //! current event stamp
+
   StringToRegexp* fTriggerToRegexp; //!
   TPRegexp& FindRegexp(const std::string& triggers) const;
 
-  ClassDef(AliPhysicsSelection, 24)
+  ClassDef(AliPhysicsSelection, 25)
 private:
   AliPhysicsSelection(const AliPhysicsSelection&);
   AliPhysicsSelection& operator=(const AliPhysicsSelection&);
@@ -85,6 +85,7 @@ ClassImp(AliNanoAODReplicator)
 AliNanoAODReplicator::AliNanoAODReplicator() :
 AliAODBranchReplicator(), 
   fTrackCut(0), fTracks(0x0), fHeader(0x0), fNTracksVariables(0), // FIXME: Start using cuts, and check if fNTracksVariables is needed
+  fTrackProjection(), fTrackProjectionCompiled(kFALSE),
   fVertices(0x0), 
   fList(0x0),
   fMCParticles(0x0),
@@ -112,6 +113,7 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title,
   AliAODBranchReplicator(name,title), 
 
   fTrackCut(trackCut), fTracks(0x0), fHeader(0x0), fNTracksVariables(0), // FIXME: Start using cuts, and check if fNTracksVariables is needed
+  fTrackProjection(), fTrackProjectionCompiled(kFALSE),
   fVertices(0x0), 
   fList(0x0),
   fMCParticles(0x0),
@@ -460,6 +462,38 @@ TList* AliNanoAODReplicator::GetList() const
   return fList;
 }
 
+//_____________________________________________________________________________
+Int_t AliNanoAODReplicator::ProjectTracks(const AliAODEvent& source)
+{
+  // Fills fTracks with the selected tracks projected on the variables of fVarList.
+  // The variable list is translated into AOD track getters once (see
+  // AliNanoAODTrack::CompileProjection), the tracks only apply them.
+  // Returns the number of tracks stored
+
+  if (!fTrackProjectionCompiled) {
+    AliNanoAODTrackMapping::GetInstance(fVarList);
+    AliNanoAODTrack::CompileProjection(fTrackProjection);
+    fTrackProjectionCompiled = kTRUE;
+  }
+
+  const Int_t entries = source.GetNumberOfTracks();
+  if (fTracks->GetSize() < entries) fTracks->Expand(entries);
+
+  Int_t ntracks(0);
+  for(Int_t j=0; j<entries; j++){
+    
+    AliVTrack *track = (AliVTrack*)source.GetTrack(j);
+    
+    AliAODTrack *aodtrack =(AliAODTrack*)track;// FIXME DYNAMIC CAST?
+    if(fTrackCut && !fTrackCut->IsSelected(aodtrack)) continue;
+
+    AliNanoAODTrack * special = new((*fTracks)[ntracks++]) AliNanoAODTrack (aodtrack, fTrackProjection);
+
+    if(fCustomSetter) fCustomSetter->SetNanoAODTrack(aodtrack, special);
+  }  
+  return ntracks;
+}
+
 //_____________________________________________________________________________
 void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
 {
@@ -485,7 +519,6 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     }
     fMCParticles->Clear("C");
   }
-  Int_t ntracks(0);
   Int_t input(0);
 
   AliAODVertex *vtx = source.GetPrimaryVertex();
@@ -497,20 +530,8 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     fCustomSetter->SetNanoAODHeader(&source, fHeader,fVarListHeader);
   }
 
-  const Int_t entries = source.GetNumberOfTracks();
-  if(entries<=0) return;
-
-  for(Int_t j=0; j<entries; j++){
-    
-    AliVTrack *track = (AliVTrack*)source.GetTrack(j);
-    
-    AliAODTrack *aodtrack =(AliAODTrack*)track;// FIXME DYNAMIC CAST?
-    if(fTrackCut && !fTrackCut->IsSelected(aodtrack)) continue;
-
-    AliNanoAODTrack * special = new((*fTracks)[ntracks++]) AliNanoAODTrack (aodtrack, fVarList);
-
-    if(fCustomSetter) fCustomSetter->SetNanoAODTrack(aodtrack, special);
-  }  
+  if(source.GetNumberOfTracks()<=0) return;
+  ProjectTracks(source);
   //----------------------------------------------------------
   
   TIter nextV(source.GetVertices());
@@ -15,6 +15,7 @@
 #endif
 
 #include <iostream>
+#include "AliNanoAODTrack.h"
 
 /* #ifndef AliAOD3LH_H */
 /* #include "AliAOD3LH.h" */
@@ -106,6 +107,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   void CreateLabelMap(const AliAODEvent& source);
   Int_t GetNewLabel(Int_t i);
   void FilterMC(const AliAODEvent& source);
+  Int_t ProjectTracks(const AliAODEvent& source);
  
 
  private:
@@ -114,6 +116,8 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   mutable TClonesArray* fTracks; //! internal array of arrays of NanoAOD tracks
   mutable AliNanoAODHeader* fHeader; //! internal array of headers
   Int_t fNTracksVariables; //! Number of variables in the array
+  AliNanoAODTrack::Projection fTrackProjection; //! fVarList compiled into AOD track getters
+  Bool_t fTrackProjectionCompiled; //! kTRUE once fTrackProjection is compiled
  
   mutable TClonesArray* fVertices; //! internal array of vertices
  
@@ -144,7 +148,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
   
-  ClassDef(AliNanoAODReplicator,2) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator,3) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
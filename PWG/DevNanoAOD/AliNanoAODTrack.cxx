@@ -66,68 +66,156 @@ AliNanoAODTrack::AliNanoAODTrack(AliAODTrack * aodTrack, const char * vars) :
   fAODEvent(NULL)
 {
   // constructor
+  // The variable names are matched only when the list changes, see CompileProjection
+
+  static TString projectionVars;
+  static Projection projection;
+  static Bool_t isCompiled = kFALSE;
 
-  Double_t position[3];
-  Bool_t isPosAvailable = !(aodTrack->GetXYZ(position)); // GetXYZ() returns kTRUE, if it's DCA information
   AliNanoAODTrackMapping::GetInstance(vars);
+  if (!isCompiled || projectionVars != vars) {
+    CompileProjection(projection);
+    projectionVars = vars;
+    isCompiled = kTRUE;
+  }
 
   // Create internal structure
   AllocateInternalStorage(AliNanoAODTrackMapping::GetInstance()->GetSize());
+  Project(aodTrack, projection);
+}
 
-  for (Int_t index = 0; index<AliNanoAODTrackMapping::GetInstance()->GetSize(); index++) {
-    TString varString = AliNanoAODTrackMapping::GetInstance()->GetVarName(index);
-
-    if     (varString == "pt"                     ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()               , aodTrack->Pt()                      );
-    else if(varString == "phi"                    ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()              , aodTrack->Phi()                     );
-    else if(varString == "theta"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()            , aodTrack->Theta()                   );
-    else if(varString == "chi2perNDF"             ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF()       , aodTrack->Chi2perNDF()              );  
-    else if(varString == "posx" && isPosAvailable ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()             , position[0]                         );
-    else if(varString == "posy" && isPosAvailable ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY()             , position[1]                         );
-    else if(varString == "posz" && isPosAvailable ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosZ()             , position[2]                         );
-    else if(varString == "posDCAx"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAx()          , aodTrack->XAtDCA()                  );
-    else if(varString == "posDCAy"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAy()          , aodTrack->YAtDCA()                  );
-    else if(varString == "pDCAx"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAX()            , aodTrack->PxAtDCA()                 );
-    else if(varString == "pDCAy"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAY()            , aodTrack->PyAtDCA()                 );
-    else if(varString == "pDCAz"                  ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAZ()            , aodTrack->PzAtDCA()                 );
-    else if(varString == "RAtAbsorberEnd"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetRAtAbsorberEnd()   , aodTrack->GetRAtAbsorberEnd()       );
-    else if(varString == "TPCncls"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCncls()          , aodTrack->GetTPCNcls()              );
-    else if(varString == "id"                     ) SetVar(AliNanoAODTrackMapping::GetInstance()->Getid()               , aodTrack->GetID()                   );
-    else if(varString == "TPCnclsF"               ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsF()         , aodTrack->GetTPCNclsF()             );
-    else if(varString == "TPCNCrossedRows"        ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCNCrossedRows()  , aodTrack->GetTPCNCrossedRows()      );
-    else if(varString == "TrackPhiOnEMCal"        ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPhiOnEMCal()  , aodTrack->GetTrackPhiOnEMCal()      );
-    else if(varString == "TrackEtaOnEMCal"        ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackEtaOnEMCal()  , aodTrack->GetTrackEtaOnEMCal()      );
-    else if(varString == "TrackPtOnEMCal"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPtOnEMCal()   , aodTrack->GetTrackPtOnEMCal()       );
-    else if(varString == "ITSsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetITSsignal()        , aodTrack->GetITSsignal()            );
-    else if(varString == "TPCsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignal()        , aodTrack->GetTPCsignal()            );
-    else if(varString == "TPCsignalTuned"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalTuned()   , aodTrack->GetTPCsignalTunedOnData() );
-    else if(varString == "TPCsignalN"             ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalN()       , aodTrack->GetTPCsignalN()           );
-    else if(varString == "TPCmomentum"            ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCmomentum()      , aodTrack->GetTPCmomentum()          );
-    else if(varString == "TPCTgl"                 ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCTgl()           , aodTrack->GetTPCTgl()               );
-    else if(varString == "TOFsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignal()        , aodTrack->GetTOFsignal()            );
-    else if(varString == "integratedLength"       ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetintegratedLenght() , aodTrack->GetIntegratedLength()     );
-    else if(varString == "TOFsignalTuned"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignalTuned()   , aodTrack->GetTOFsignalTunedOnData() );
-    else if(varString == "HMPIDsignal"            ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDsignal()      , aodTrack->GetHMPIDsignal()          );
-    else if(varString == "HMPIDoccupancy"         ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDoccupancy()   , aodTrack->GetHMPIDoccupancy()       );
-    else if(varString == "TRDsignal"              ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDsignal()        , aodTrack->GetTRDsignal()            );
-    else if(varString == "TRDChi2"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDChi2()          , aodTrack->GetTRDchi2()              );
-    else if(varString == "TRDnSlices"             ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDnSlices()       , aodTrack->GetNumberOfTRDslices()    );  
-    else if(varString == "IsMuonTrack"             ) {
-        if (aodTrack->IsMuonTrack()) SetVar(AliNanoAODTrackMapping::GetInstance()->GetIsMuonTrack(), 1.);
-        else SetVar(AliNanoAODTrackMapping::GetInstance()->GetIsMuonTrack(), 0.);
+//______________________________________________________________________________
+AliNanoAODTrack::AliNanoAODTrack(AliAODTrack * aodTrack, const Projection & projection) :
+  AliVTrack(), 
+  AliNanoAODStorage(),
+  fLabel(0),
+  fProdVertex(0),
+  fCharge(0),
+  fAODEvent(NULL)
+{
+  // constructor with a projection compiled for the current track mapping (see CompileProjection)
+
+  AllocateInternalStorage(AliNanoAODTrackMapping::GetInstance()->GetSize());
+  Project(aodTrack, projection);
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrack::CompileProjection(Projection & projection)
+{
+  // Translates the variables of the current track mapping into the list of
+  // AOD track getters to be applied, in the order of the mapping.
+  // Custom variables ("cst...") are not filled here (see AliNanoAODCustomSetter)
+
+  AliNanoAODTrackMapping * mapping = AliNanoAODTrackMapping::GetInstance();
+  projection.clear();
+
+  for (Int_t index = 0; index<mapping->GetSize(); index++) {
+    TString varString = mapping->GetVarName(index);
+    ProjectedVar var = {-1, -1};
+
+    if     (varString == "pt"                     ) { var.fVar = kProjPt;               var.fIndex = mapping->GetPt();               }
+    else if(varString == "phi"                    ) { var.fVar = kProjPhi;              var.fIndex = mapping->GetPhi();              }
+    else if(varString == "theta"                  ) { var.fVar = kProjTheta;            var.fIndex = mapping->GetTheta();            }
+    else if(varString == "chi2perNDF"             ) { var.fVar = kProjChi2PerNDF;       var.fIndex = mapping->GetChi2PerNDF();       }
+    else if(varString == "posx"                   ) { var.fVar = kProjPosX;             var.fIndex = mapping->GetPosX();             }
+    else if(varString == "posy"                   ) { var.fVar = kProjPosY;             var.fIndex = mapping->GetPosY();             }
+    else if(varString == "posz"                   ) { var.fVar = kProjPosZ;             var.fIndex = mapping->GetPosZ();             }
+    else if(varString == "posDCAx"                ) { var.fVar = kProjPosDCAx;          var.fIndex = mapping->GetPosDCAx();          }
+    else if(varString == "posDCAy"                ) { var.fVar = kProjPosDCAy;          var.fIndex = mapping->GetPosDCAy();          }
+    else if(varString == "pDCAx"                  ) { var.fVar = kProjPDCAx;            var.fIndex = mapping->GetPDCAX();            }
+    else if(varString == "pDCAy"                  ) { var.fVar = kProjPDCAy;            var.fIndex = mapping->GetPDCAY();            }
+    else if(varString == "pDCAz"                  ) { var.fVar = kProjPDCAz;            var.fIndex = mapping->GetPDCAZ();            }
+    else if(varString == "RAtAbsorberEnd"         ) { var.fVar = kProjRAtAbsorberEnd;   var.fIndex = mapping->GetRAtAbsorberEnd();   }
+    else if(varString == "TPCncls"                ) { var.fVar = kProjTPCncls;          var.fIndex = mapping->GetTPCncls();          }
+    else if(varString == "id"                     ) { var.fVar = kProjID;               var.fIndex = mapping->Getid();               }
+    else if(varString == "TPCnclsF"               ) { var.fVar = kProjTPCnclsF;         var.fIndex = mapping->GetTPCnclsF();         }
+    else if(varString == "TPCNCrossedRows"        ) { var.fVar = kProjTPCNCrossedRows;  var.fIndex = mapping->GetTPCNCrossedRows();  }
+    else if(varString == "TrackPhiOnEMCal"        ) { var.fVar = kProjTrackPhiOnEMCal;  var.fIndex = mapping->GetTrackPhiOnEMCal();  }
+    else if(varString == "TrackEtaOnEMCal"        ) { var.fVar = kProjTrackEtaOnEMCal;  var.fIndex = mapping->GetTrackEtaOnEMCal();  }
+    else if(varString == "TrackPtOnEMCal"         ) { var.fVar = kProjTrackPtOnEMCal;   var.fIndex = mapping->GetTrackPtOnEMCal();   }
+    else if(varString == "ITSsignal"              ) { var.fVar = kProjITSsignal;        var.fIndex = mapping->GetITSsignal();        }
+    else if(varString == "TPCsignal"              ) { var.fVar = kProjTPCsignal;        var.fIndex = mapping->GetTPCsignal();        }
+    else if(varString == "TPCsignalTuned"         ) { var.fVar = kProjTPCsignalTuned;   var.fIndex = mapping->GetTPCsignalTuned();   }
+    else if(varString == "TPCsignalN"             ) { var.fVar = kProjTPCsignalN;       var.fIndex = mapping->GetTPCsignalN();       }
+    else if(varString == "TPCmomentum"            ) { var.fVar = kProjTPCmomentum;      var.fIndex = mapping->GetTPCmomentum();      }
+    else if(varString == "TPCTgl"                 ) { var.fVar = kProjTPCTgl;           var.fIndex = mapping->GetTPCTgl();           }
+    else if(varString == "TOFsignal"              ) { var.fVar = kProjTOFsignal;        var.fIndex = mapping->GetTOFsignal();        }
+    else if(varString == "integratedLength"       ) { var.fVar = kProjIntegratedLength; var.fIndex = mapping->GetintegratedLenght(); }
+    else if(varString == "TOFsignalTuned"         ) { var.fVar = kProjTOFsignalTuned;   var.fIndex = mapping->GetTOFsignalTuned();   }
+    else if(varString == "HMPIDsignal"            ) { var.fVar = kProjHMPIDsignal;      var.fIndex = mapping->GetHMPIDsignal();      }
+    else if(varString == "HMPIDoccupancy"         ) { var.fVar = kProjHMPIDoccupancy;   var.fIndex = mapping->GetHMPIDoccupancy();   }
+    else if(varString == "TRDsignal"              ) { var.fVar = kProjTRDsignal;        var.fIndex = mapping->GetTRDsignal();        }
+    else if(varString == "TRDChi2"                ) { var.fVar = kProjTRDChi2;          var.fIndex = mapping->GetTRDChi2();          }
+    else if(varString == "TRDnSlices"             ) { var.fVar = kProjTRDnSlices;       var.fIndex = mapping->GetTRDnSlices();       }
+    else if(varString == "IsMuonTrack"            ) { var.fVar = kProjIsMuonTrack;      var.fIndex = mapping->GetIsMuonTrack();      }
+    else if(varString == "TPCnclsS"               ) { var.fVar = kProjTPCnclsS;         var.fIndex = mapping->GetTPCnclsS();         }
+    else if(varString == "FilterMap"              ) { var.fVar = kProjFilterMap;        var.fIndex = mapping->GetFilterMap();        }
+    else if(varString == "covmat0"                ) { var.fVar = kProjCovMat;           index+=20;                                   }
+
+    if (var.fVar >= 0) projection.push_back(var);
+  }
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrack::Project(AliAODTrack * aodTrack, const Projection & projection)
+{
+  // Fills the variables of the projection from the AOD track
+
+  Double_t position[3];
+  Bool_t isPosAvailable = !(aodTrack->GetXYZ(position)); // GetXYZ() returns kTRUE, if it's DCA information
+
+  const Int_t nvars = projection.size();
+  for (Int_t ivar = 0; ivar < nvars; ivar++) {
+    const Int_t index = projection[ivar].fIndex;
+    switch (projection[ivar].fVar) {
+    case kProjPt               : SetVar(index, aodTrack->Pt()                      ); break;
+    case kProjPhi              : SetVar(index, aodTrack->Phi()                     ); break;
+    case kProjTheta            : SetVar(index, aodTrack->Theta()                   ); break;
+    case kProjChi2PerNDF       : SetVar(index, aodTrack->Chi2perNDF()              ); break;
+    case kProjPosX             : if (isPosAvailable) SetVar(index, position[0]     ); break;
+    case kProjPosY             : if (isPosAvailable) SetVar(index, position[1]     ); break;
+    case kProjPosZ             : if (isPosAvailable) SetVar(index, position[2]     ); break;
+    case kProjPosDCAx          : SetVar(index, aodTrack->XAtDCA()                  ); break;
+    case kProjPosDCAy          : SetVar(index, aodTrack->YAtDCA()                  ); break;
+    case kProjPDCAx            : SetVar(index, aodTrack->PxAtDCA()                 ); break;
+    case kProjPDCAy            : SetVar(index, aodTrack->PyAtDCA()                 ); break;
+    case kProjPDCAz            : SetVar(index, aodTrack->PzAtDCA()                 ); break;
+    case kProjRAtAbsorberEnd   : SetVar(index, aodTrack->GetRAtAbsorberEnd()       ); break;
+    case kProjTPCncls          : SetVar(index, aodTrack->GetTPCNcls()              ); break;
+    case kProjID               : SetVar(index, aodTrack->GetID()                   ); break;
+    case kProjTPCnclsF         : SetVar(index, aodTrack->GetTPCNclsF()             ); break;
+    case kProjTPCNCrossedRows  : SetVar(index, aodTrack->GetTPCNCrossedRows()      ); break;
+    case kProjTrackPhiOnEMCal  : SetVar(index, aodTrack->GetTrackPhiOnEMCal()      ); break;
+    case kProjTrackEtaOnEMCal  : SetVar(index, aodTrack->GetTrackEtaOnEMCal()      ); break;
+    case kProjTrackPtOnEMCal   : SetVar(index, aodTrack->GetTrackPtOnEMCal()       ); break;
+    case kProjITSsignal        : SetVar(index, aodTrack->GetITSsignal()            ); break;
+    case kProjTPCsignal        : SetVar(index, aodTrack->GetTPCsignal()            ); break;
+    case kProjTPCsignalTuned   : SetVar(index, aodTrack->GetTPCsignalTunedOnData() ); break;
+    case kProjTPCsignalN       : SetVar(index, aodTrack->GetTPCsignalN()           ); break;
+    case kProjTPCmomentum      : SetVar(index, aodTrack->GetTPCmomentum()          ); break;
+    case kProjTPCTgl           : SetVar(index, aodTrack->GetTPCTgl()               ); break;
+    case kProjTOFsignal        : SetVar(index, aodTrack->GetTOFsignal()            ); break;
+    case kProjIntegratedLength : SetVar(index, aodTrack->GetIntegratedLength()     ); break;
+    case kProjTOFsignalTuned   : SetVar(index, aodTrack->GetTOFsignalTunedOnData() ); break;
+    case kProjHMPIDsignal      : SetVar(index, aodTrack->GetHMPIDsignal()          ); break;
+    case kProjHMPIDoccupancy   : SetVar(index, aodTrack->GetHMPIDoccupancy()       ); break;
+    case kProjTRDsignal        : SetVar(index, aodTrack->GetTRDsignal()            ); break;
+    case kProjTRDChi2          : SetVar(index, aodTrack->GetTRDchi2()              ); break;
+    case kProjTRDnSlices       : SetVar(index, aodTrack->GetNumberOfTRDslices()    ); break;
+    case kProjIsMuonTrack      : SetVar(index, aodTrack->IsMuonTrack() ? 1. : 0.   ); break;
+    case kProjTPCnclsS         : SetVar(index, aodTrack->GetTPCnclsS()             ); break;
+    case kProjFilterMap        : SetVar(index, aodTrack->GetFilterMap()            ); break;
+    case kProjCovMat : {
+      Double_t covMatrix[21];
+      aodTrack->GetCovarianceXYZPxPyPz(covMatrix);
+      for(Int_t i=0;i<21;i++){
+        SetVar(AliNanoAODTrackMapping::GetInstance()->GetCovMat(i), covMatrix[i]);
+      }
+      break;
     }
-    else if(varString == "TPCnclsS"                ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsS()         , aodTrack->GetTPCnclsS()             );
-    else if(varString == "FilterMap"               ) SetVar(AliNanoAODTrackMapping::GetInstance()->GetFilterMap()        , aodTrack->GetFilterMap()            );
-    else if(varString == "covmat0"                 ) {
-        Double_t covMatrix[21];
-        Bool_t covmatrix = aodTrack->GetCovarianceXYZPxPyPz(covMatrix);
-        for(Int_t i=0;i<21;i++){
-            SetVar(AliNanoAODTrackMapping::GetInstance()->GetCovMat(i)       , covMatrix[i]                        );
-        }
-        index+=20;
     }
   }
 
-
   fLabel = aodTrack->GetLabel();
   fCharge = aodTrack->Charge();
   fProdVertex = aodTrack->GetProdVertex();
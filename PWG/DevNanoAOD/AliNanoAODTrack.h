@@ -71,9 +71,24 @@ class AliNanoAODTrack : public AliVTrack, public AliNanoAODStorage {
 public:
   
   using TObject::ClassName;
+
+  // Projection of AOD tracks on the variables of the track mapping, compiled once
+  // from the variable names (see CompileProjection) and applied to every track
+  enum EProjectedVar { kProjPt, kProjPhi, kProjTheta, kProjChi2PerNDF, kProjPosX, kProjPosY, kProjPosZ,
+		       kProjPosDCAx, kProjPosDCAy, kProjPDCAx, kProjPDCAy, kProjPDCAz, kProjRAtAbsorberEnd,
+		       kProjTPCncls, kProjID, kProjTPCnclsF, kProjTPCNCrossedRows, kProjTrackPhiOnEMCal,
+		       kProjTrackEtaOnEMCal, kProjTrackPtOnEMCal, kProjITSsignal, kProjTPCsignal,
+		       kProjTPCsignalTuned, kProjTPCsignalN, kProjTPCmomentum, kProjTPCTgl, kProjTOFsignal,
+		       kProjIntegratedLength, kProjTOFsignalTuned, kProjHMPIDsignal, kProjHMPIDoccupancy,
+		       kProjTRDsignal, kProjTRDChi2, kProjTRDnSlices, kProjIsMuonTrack, kProjTPCnclsS,
+		       kProjFilterMap, kProjCovMat };
+  struct ProjectedVar { Int_t fVar; Int_t fIndex; }; // EProjectedVar, index in the variable array
+  typedef std::vector<ProjectedVar> Projection;
+  static void CompileProjection(Projection & projection);
   
   AliNanoAODTrack();
   AliNanoAODTrack(AliAODTrack * aodTrack, const char * vars);
+  AliNanoAODTrack(AliAODTrack * aodTrack, const Projection & projection);
   AliNanoAODTrack(AliESDTrack * esdTrack, const char * vars);
   AliNanoAODTrack(const char * vars);
 
@@ -373,7 +388,7 @@ void SetChi2perNDF(Double_t chi2perNDF) { fVars[AliNanoAODTrackMapping::GetInsta
 
 private :
 
-
+  void Project(AliAODTrack * aodTrack, const Projection & projection);
 
   // Momentum & position
   // FIXME: the following was replaced by posx, posy, posz. Check if the names make sense
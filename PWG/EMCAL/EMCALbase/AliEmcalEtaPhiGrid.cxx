@@ -0,0 +1,180 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <algorithm>
+
+#include <TMath.h>
+
+#include "AliEmcalEtaPhiGrid.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalEtaPhiGrid)
+/// \endcond
+
+const Double_t AliEmcalEtaPhiGrid::fgkMinCellSize = 0.05;
+const Int_t    AliEmcalEtaPhiGrid::fgkMaxEtaCells = 200;
+
+//________________________________________________________________________
+AliEmcalEtaPhiGrid::AliEmcalEtaPhiGrid() :
+  TObject(),
+  fWindow(0),
+  fNEntries(0),
+  fEta(),
+  fPhi(),
+  fEtaMin(0),
+  fEtaCellSize(fgkMinCellSize),
+  fPhiCellSize(fgkMinCellSize),
+  fNEtaCells(0),
+  fNPhiCells(0),
+  fCellStart(),
+  fCellEntries(),
+  fEntryCell()
+{
+  // Constructor.
+}
+
+/// Remove all objects and set the matching window used to size the cells in the next Build()
+//________________________________________________________________________
+void AliEmcalEtaPhiGrid::Reset(Double_t window)
+{
+  fWindow = window;
+  fNEntries = 0;
+  fNEtaCells = 0;
+  fNPhiCells = 0;
+}
+
+/// Add an object at (eta, phi); its index is the number of objects added before it
+//________________________________________________________________________
+void AliEmcalEtaPhiGrid::Add(Double_t eta, Double_t phi)
+{
+  if (fNEntries >= fEta.GetSize()) {
+    Int_t size = TMath::Max(2 * fEta.GetSize(), 64);
+    fEta.Set(size);
+    fPhi.Set(size);
+  }
+  fEta[fNEntries] = eta;
+  fPhi[fNEntries] = phi;
+  fNEntries++;
+}
+
+/// Index the objects added since the last Reset() by cell (counting sort, stable in the object index)
+//________________________________________________________________________
+void AliEmcalEtaPhiGrid::Build()
+{
+  Double_t etaMin = 0;
+  Double_t etaMax = 0;
+  Bool_t first = kTRUE;
+  for (Int_t i = 0; i < fNEntries; i++) {
+    if (!TMath::Finite(fEta[i]) || !TMath::Finite(fPhi[i])) continue;
+    if (first || fEta[i] < etaMin) etaMin = fEta[i];
+    if (first || fEta[i] > etaMax) etaMax = fEta[i];
+    first = kFALSE;
+  }
+
+  // slightly larger than the window, so that a match can be at most one cell away
+  Double_t cellSize = TMath::Max(fWindow * (1. + 1e-6), fgkMinCellSize);
+
+  fNPhiCells = TMath::Max(Int_t(TMath::TwoPi() / cellSize), 1);
+  fPhiCellSize = TMath::TwoPi() / fNPhiCells;
+
+  fEtaMin = etaMin;
+  fEtaCellSize = cellSize;
+  fNEtaCells = Int_t((etaMax - etaMin) / fEtaCellSize) + 1;
+  if (fNEtaCells > fgkMaxEtaCells) {
+    fNEtaCells = fgkMaxEtaCells;
+    fEtaCellSize = (etaMax - etaMin) / (fNEtaCells - 1);
+  }
+
+  const Int_t nCells = fNEtaCells * fNPhiCells + 1; // last cell holds non-finite entries
+  if (fCellStart.GetSize() < nCells + 1) fCellStart.Set(nCells + 1);
+  if (fCellEntries.GetSize() < fNEntries) fCellEntries.Set(fEta.GetSize());
+  if (fEntryCell.GetSize() < fNEntries) fEntryCell.Set(fEta.GetSize());
+
+  Int_t *start = fCellStart.GetArray();
+  for (Int_t icell = 0; icell <= nCells; icell++) start[icell] = 0;
+
+  for (Int_t i = 0; i < fNEntries; i++) {
+    Int_t cell = nCells - 1;
+    if (TMath::Finite(fEta[i]) && TMath::Finite(fPhi[i])) {
+      Int_t ieta = TMath::Min(Int_t((fEta[i] - fEtaMin) / fEtaCellSize), fNEtaCells - 1);
+      cell = ieta * fNPhiCells + GetPhiCell(fPhi[i]);
+    }
+    fEntryCell[i] = cell;
+    start[cell + 1]++;
+  }
+  for (Int_t icell = 0; icell < nCells; icell++) start[icell + 1] += start[icell];
+  for (Int_t i = 0; i < fNEntries; i++) fCellEntries[start[fEntryCell[i]]++] = i;
+  for (Int_t icell = nCells; icell > 0; icell--) start[icell] = start[icell - 1];
+  start[0] = 0;
+}
+
+/// Collect the indices of all objects that can be within the window around (eta, phi)
+/// \param eta Eta of the probe
+/// \param phi Phi of the probe (any range)
+/// \param candidates Array receiving the indices in ascending order (enlarged if needed)
+/// \return Number of candidates
+//________________________________________________________________________
+Int_t AliEmcalEtaPhiGrid::GetCandidates(Double_t eta, Double_t phi, TArrayI &candidates) const
+{
+  Int_t n = 0;
+  if (fNEntries <= 0 || fNPhiCells <= 0) return n;
+
+  if (!TMath::Finite(eta) || !TMath::Finite(phi)) {
+    if (candidates.GetSize() < fNEntries) candidates.Set(fNEntries);
+    for (Int_t i = 0; i < fNEntries; i++) candidates[n++] = i;
+    return n;
+  }
+
+  Double_t x = (eta - fEtaMin) / fEtaCellSize;
+  if (x >= -1. && x < fNEtaCells + 1.) {
+    Int_t ieta = Int_t(TMath::Floor(x));
+    Int_t ietaMin = TMath::Max(ieta - 1, 0);
+    Int_t ietaMax = TMath::Min(ieta + 1, fNEtaCells - 1);
+    Int_t iphi = GetPhiCell(phi);
+    Int_t nPhiProbe = TMath::Min(fNPhiCells, 3);
+    for (Int_t ie = ietaMin; ie <= ietaMax; ie++) {
+      for (Int_t k = 0; k < nPhiProbe; k++) {
+        Int_t ip = fNPhiCells < 3 ? k : (iphi - 1 + k + fNPhiCells) % fNPhiCells;
+        AppendCell(ie * fNPhiCells + ip, candidates, n);
+      }
+    }
+  }
+  AppendCell(fNEtaCells * fNPhiCells, candidates, n);
+
+  std::sort(candidates.GetArray(), candidates.GetArray() + n);
+  return n;
+}
+
+/// Phi cell of an angle in any range
+//________________________________________________________________________
+Int_t AliEmcalEtaPhiGrid::GetPhiCell(Double_t phi) const
+{
+  phi = TMath::Abs(phi) < TMath::TwoPi() ? phi : fmod(phi, TMath::TwoPi());
+  if (phi < 0) phi += TMath::TwoPi();
+  Int_t iphi = Int_t(phi / fPhiCellSize);
+  if (iphi >= fNPhiCells) iphi = fNPhiCells - 1;
+  return iphi;
+}
+
+/// Append the indices of the objects in a cell
+//________________________________________________________________________
+void AliEmcalEtaPhiGrid::AppendCell(Int_t cell, TArrayI &candidates, Int_t &n) const
+{
+  const Int_t first = fCellStart[cell];
+  const Int_t count = fCellStart[cell + 1] - first;
+  if (count <= 0) return;
+  if (candidates.GetSize() < n + count) candidates.Set(TMath::Max(2 * (n + count), 64));
+  for (Int_t i = 0; i < count; i++) candidates[n++] = fCellEntries[first + i];
+}
@@ -0,0 +1,60 @@
+#ifndef ALIEMCALETAPHIGRID_H
+#define ALIEMCALETAPHIGRID_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/**
+ * \class AliEmcalEtaPhiGrid
+ * \brief Eta-phi binned index over a set of objects (e.g. clusters) for neighbour searches
+ *
+ * Objects are added with Add() and indexed once per event with Build(). The cell size is
+ * at least the matching window, so GetCandidates() only has to probe the 3x3 cells around
+ * the requested position (phi is periodic). Candidates are returned in ascending order of
+ * the index in which the objects were added, i.e. the same order as a brute-force loop.
+ * Objects or positions with non-finite coordinates are always returned as candidates.
+ *
+ * \ingroup EMCALCOREFW
+ */
+
+#include <TObject.h>
+#include <TArrayD.h>
+#include <TArrayI.h>
+
+class AliEmcalEtaPhiGrid : public TObject {
+
+public:
+  AliEmcalEtaPhiGrid();
+  virtual ~AliEmcalEtaPhiGrid() {}
+
+  void                        Reset(Double_t window);
+  void                        Add(Double_t eta, Double_t phi);
+  void                        Build();
+  Int_t                       GetCandidates(Double_t eta, Double_t phi, TArrayI &candidates) const;
+  Int_t                       GetNEntries() const { return fNEntries; }
+
+private:
+  Int_t                       GetPhiCell(Double_t phi) const;
+  void                        AppendCell(Int_t cell, TArrayI &candidates, Int_t &n) const;
+
+  static const Double_t       fgkMinCellSize;                 ///< lower bound on the cell size to limit the number of cells
+  static const Int_t          fgkMaxEtaCells;                 ///< upper bound on the number of cells in eta
+
+  Double_t                    fWindow;                        ///< matching window (cells are at least this large)
+  Int_t                       fNEntries;                      ///< number of objects added since the last Reset()
+  TArrayD                     fEta;                           ///< eta of the objects
+  TArrayD                     fPhi;                           ///< phi of the objects
+  Double_t                    fEtaMin;                        ///< lower edge of the first eta cell
+  Double_t                    fEtaCellSize;                   ///< cell size in eta
+  Double_t                    fPhiCellSize;                   ///< cell size in phi
+  Int_t                       fNEtaCells;                     ///< number of cells in eta
+  Int_t                       fNPhiCells;                     ///< number of cells in phi
+  TArrayI                     fCellStart;                     ///< offset of each cell in fCellEntries (last cell holds non-finite entries)
+  TArrayI                     fCellEntries;                   ///< object indices ordered by cell, ascending within a cell
+  TArrayI                     fEntryCell;                     ///< cell of each object
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalEtaPhiGrid, 1);
+  /// \endcond
+};
+
+#endif
@@ -7,6 +7,7 @@
 
 #include <TClonesArray.h>
 #include <TClass.h>
+#include <TVector3.h>
 
 #include <AliAODCaloCluster.h>
 #include <AliESDCaloCluster.h>
@@ -29,6 +30,7 @@ AliEmcalClusTrackMatcherTask::AliEmcalClusTrackMatcherTask() :
   fAttemptProp(kTRUE),
   fAttemptPropMatch(kFALSE),
   fMaxDistance(0.1),
+  fUseEtaPhiGrid(kTRUE),
   fAttachEmcalParticles(kFALSE),
   fUpdateTracks(kTRUE),
   fUpdateClusters(kTRUE),
@@ -36,6 +38,8 @@ AliEmcalClusTrackMatcherTask::AliEmcalClusTrackMatcherTask() :
   fEmcalClusters(0),
   fNEmcalTracks(0),
   fNEmcalClusters(0),
+  fClusterGrid(),
+  fClusterCandidates(),
   fHistMatchEtaAll(0),
   fHistMatchPhiAll(0)
 {
@@ -59,6 +63,7 @@ AliEmcalClusTrackMatcherTask::AliEmcalClusTrackMatcherTask(const char *name, Boo
   fAttemptProp(kTRUE),
   fAttemptPropMatch(kFALSE),
   fMaxDistance(0.1),
+  fUseEtaPhiGrid(kTRUE),
   fAttachEmcalParticles(kFALSE),
   fUpdateTracks(kTRUE),
   fUpdateClusters(kTRUE),
@@ -66,6 +71,8 @@ AliEmcalClusTrackMatcherTask::AliEmcalClusTrackMatcherTask(const char *name, Boo
   fEmcalClusters(0),
   fNEmcalTracks(0),
   fNEmcalClusters(0),
+  fClusterGrid(),
+  fClusterCandidates(),
   fHistMatchEtaAll(0),
   fHistMatchPhiAll(0)
 {
@@ -276,6 +283,22 @@ void AliEmcalClusTrackMatcherTask::GenerateEmcalParticles()
   }
 }
 
+//________________________________________________________________________
+void AliEmcalClusTrackMatcherTask::BuildClusterGrid()
+{
+  // Index the cluster positions in eta-phi cells of the size of the matching window.
+
+  fClusterGrid.Reset(fMaxDistance);
+  for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
+    Float_t pos[3] = {0};
+    emcalCluster->GetCluster()->GetPosition(pos);
+    TVector3 cpos(pos);
+    fClusterGrid.Add(cpos.Eta(), cpos.Phi());
+  }
+  fClusterGrid.Build();
+}
+
 //________________________________________________________________________
 void AliEmcalClusTrackMatcherTask::DoMatching() 
 {
@@ -283,11 +306,18 @@ void AliEmcalClusTrackMatcherTask::DoMatching()
 
   const Double_t maxd2 = fMaxDistance*fMaxDistance;
 
+  if (fUseEtaPhiGrid) BuildClusterGrid();
+
   for (Int_t itrack = 0; itrack < fNEmcalTracks; itrack++) {
     AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->At(itrack));
     AliVTrack* track = emcalTrack->GetTrack();
 
-    for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    // Only clusters in the neighbouring eta-phi cells can be within fMaxDistance
+    Int_t ncand = fNEmcalClusters;
+    if (fUseEtaPhiGrid) ncand = fClusterGrid.GetCandidates(track->GetTrackEtaOnEMCal(), track->GetTrackPhiOnEMCal(), fClusterCandidates);
+
+    for (Int_t icand = 0; icand < ncand; icand++) {
+      Int_t icluster = fUseEtaPhiGrid ? fClusterCandidates[icand] : icand;
       AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
       AliVCluster* cluster = emcalCluster->GetCluster();
 
@@ -1,7 +1,10 @@
 #ifndef ALIEMCALCLUSTRACKMATCHERTASK_H
 #define ALIEMCALCLUSTRACKMATCHERTASK_H
 
+#include <TArrayI.h>
+
 #include "AliAnalysisTaskEmcal.h"
+#include "AliEmcalEtaPhiGrid.h"
 
 class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
  public:
@@ -14,6 +17,7 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
   void          SetAttemptProp(Bool_t b)          { fAttemptProp           = b; }
   void          SetAttemptPropMatch(Bool_t b)     { fAttemptPropMatch      = b; }
   void          SetMaxDistance(Double_t d)        { fMaxDistance           = d; }
+  void          SetUseEtaPhiGrid(Bool_t b)        { fUseEtaPhiGrid         = b; }
   void          SetAttachEmcalParticles(Bool_t b) { fAttachEmcalParticles  = b; }
   void          SetUpdateTracks(Bool_t b)         { fUpdateTracks          = b; }
   void          SetUpdateClusters(Bool_t b)       { fUpdateClusters        = b; }
@@ -25,6 +29,7 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
   void          UserCreateOutputObjects();
 
   void          GenerateEmcalParticles();
+  void          BuildClusterGrid();
   void          DoMatching();
   void          UpdateTracks();
   void          UpdateClusters();
@@ -34,6 +39,7 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
   Bool_t        fAttemptProp;           // if true then attempt to propagate if not done yet
   Bool_t        fAttemptPropMatch;      // if true then attempt to propagate if not done yet but IsEMCAL is true
   Double_t      fMaxDistance;           // maximum distance to match clusters and tracks
+  Bool_t        fUseEtaPhiGrid;         // if true then only clusters in neighbouring eta-phi cells are tested for each track
   Bool_t        fAttachEmcalParticles;  // attach emcal particles to the event, so that other tasks can use them
   Bool_t        fUpdateTracks;          // update tracks with matching info
   Bool_t        fUpdateClusters;        // update clusters with matching info
@@ -42,6 +48,8 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
   TClonesArray *fEmcalClusters;         //!emcal clusters
   Int_t         fNEmcalTracks;          //!number of emcal tracks
   Int_t         fNEmcalClusters;        //!number of emcal clusters
+  AliEmcalEtaPhiGrid fClusterGrid;      //!eta-phi index of the emcal clusters
+  TArrayI       fClusterCandidates;     //!clusters close to the current track
   TH1          *fHistMatchEtaAll;       //!deta distribution
   TH1          *fHistMatchPhiAll;       //!dphi distribution
   TH1          *fHistMatchEta[10][9][2]; //!deta distribution
@@ -51,6 +59,6 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
   AliEmcalClusTrackMatcherTask(const AliEmcalClusTrackMatcherTask&);            // not implemented
   AliEmcalClusTrackMatcherTask &operator=(const AliEmcalClusTrackMatcherTask&); // not implemented
 
-  ClassDef(AliEmcalClusTrackMatcherTask, 8) // Cluster-Track matching task
+  ClassDef(AliEmcalClusTrackMatcherTask, 9) // Cluster-Track matching task
 };
 #endif
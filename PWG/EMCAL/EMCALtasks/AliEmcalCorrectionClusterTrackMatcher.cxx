@@ -5,6 +5,7 @@
 
 #include <TH1.h>
 #include <TList.h>
+#include <TVector3.h>
 
 #include "AliClusterContainer.h"
 #include "AliParticleContainer.h"
@@ -33,6 +34,7 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fAttemptProp(kTRUE),
   fAttemptPropMatch(kFALSE),
   fMaxDistance(0.1),
+  fUseEtaPhiGrid(kTRUE),
   fUsePIDmass(kTRUE),
   fUseDCA(kTRUE),
   fUpdateTracks(kTRUE),
@@ -43,6 +45,8 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fEmcalClusters(0),
   fNEmcalTracks(0),
   fNEmcalClusters(0),
+  fClusterGrid(),
+  fClusterCandidates(),
   fHistMatchEtaAll(0),
   fHistMatchPhiAll(0),
   fNMCGenerToAccept(0),
@@ -79,6 +83,7 @@ Bool_t AliEmcalCorrectionClusterTrackMatcher::Initialize()
   GetProperty("usePIDmass", fUsePIDmass);
   GetProperty("useDCA", fUseDCA);
   GetProperty("maxDist", fMaxDistance);
+  GetProperty("useEtaPhiGrid", fUseEtaPhiGrid);
   GetProperty("updateClusters", fUpdateClusters);
   GetProperty("updateTracks", fUpdateTracks);
   fDoPropagation = fEsdMode;
@@ -362,6 +367,22 @@ void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
   }
 }
 
+/**
+ * Index the cluster positions in eta-phi cells of the size of the matching window.
+ */
+void AliEmcalCorrectionClusterTrackMatcher::BuildClusterGrid()
+{
+  fClusterGrid.Reset(fMaxDistance);
+  for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
+    Float_t pos[3] = {0};
+    emcalCluster->GetCluster()->GetPosition(pos);
+    TVector3 cpos(pos);
+    fClusterGrid.Add(cpos.Eta(), cpos.Phi());
+  }
+  fClusterGrid.Build();
+}
+
 /**
  * Set the links between tracks and clusters.
  */
@@ -369,11 +390,18 @@ void AliEmcalCorrectionClusterTrackMatcher::DoMatching()
 {
   const Double_t maxd2 = fMaxDistance*fMaxDistance;
 
+  if (fUseEtaPhiGrid) BuildClusterGrid();
+
   for (Int_t itrack = 0; itrack < fNEmcalTracks; itrack++) {
     AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->At(itrack));
     AliVTrack* track = emcalTrack->GetTrack();
 
-    for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    // Only clusters in the neighbouring eta-phi cells can be within fMaxDistance
+    Int_t ncand = fNEmcalClusters;
+    if (fUseEtaPhiGrid) ncand = fClusterGrid.GetCandidates(track->GetTrackEtaOnEMCal(), track->GetTrackPhiOnEMCal(), fClusterCandidates);
+
+    for (Int_t icand = 0; icand < ncand; icand++) {
+      Int_t icluster = fUseEtaPhiGrid ? fClusterCandidates[icand] : icand;
       AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
       AliVCluster* cluster = emcalCluster->GetCluster();
       
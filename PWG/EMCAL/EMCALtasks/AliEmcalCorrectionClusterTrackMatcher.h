@@ -1,7 +1,10 @@
 #ifndef ALIEMCALCORRECTIONCLUSTERTRACKMATCHER_H
 #define ALIEMCALCORRECTIONCLUSTERTRACKMATCHER_H
 
+#include <TArrayI.h>
+
 #include "AliEmcalCorrectionComponent.h"
+#include "AliEmcalEtaPhiGrid.h"
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
 #include "AliEmcalContainerIndexMap.h"
@@ -68,6 +71,7 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
  protected:
   Int_t         GetMomBin(Double_t p) const;
   void          GenerateEmcalParticles();
+  void          BuildClusterGrid();
   void          DoMatching();
   void          UpdateTracks();
   void          UpdateClusters();
@@ -83,6 +87,7 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   Bool_t        fAttemptProp;           ///< if true then attempt to propagate if not done yet
   Bool_t        fAttemptPropMatch;      ///< if true then attempt to propagate if not done yet but IsEMCAL is true
   Double_t      fMaxDistance;           ///< maximum distance to match clusters and tracks
+  Bool_t        fUseEtaPhiGrid;         ///< if true then only clusters in neighbouring eta-phi cells are tested for each track
   Bool_t        fUsePIDmass;            ///< Use PID-based mass hypothesis for track propagation, rather than pion mass hypothesis
   Bool_t        fUseDCA;                ///< Use DCA as starting point for track propagation, rather than primary vertex
   Bool_t        fUpdateTracks;          ///< update tracks with matching info
@@ -98,6 +103,8 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   TClonesArray *fEmcalClusters;         //!<!emcal clusters
   Int_t         fNEmcalTracks;          //!<!number of emcal tracks
   Int_t         fNEmcalClusters;        //!<!number of emcal clusters
+  AliEmcalEtaPhiGrid fClusterGrid;      //!<!eta-phi index of the emcal clusters
+  TArrayI       fClusterCandidates;     //!<!clusters close to the current track
   TH1          *fHistMatchEtaAll;       //!<!deta distribution
   TH1          *fHistMatchPhiAll;       //!<!dphi distribution
   TH1          *fHistMatchEta[10][9][2]; //!<!deta distribution
@@ -115,7 +122,7 @@ private:
   static RegisterCorrectionComponent<AliEmcalCorrectionClusterTrackMatcher> reg;
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionClusterTrackMatcher, 4); // EMCal cluster track matcher correction component
+  ClassDef(AliEmcalCorrectionClusterTrackMatcher, 5); // EMCal cluster track matcher correction component
   /// \endcond
 };
 
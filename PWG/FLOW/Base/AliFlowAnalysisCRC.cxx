@@ -45,6 +45,7 @@
 #include "AliFlowVector.h"
 #include "AliFlowTrackSimple.h"
 #include "AliFlowAnalysisCRC.h"
+#include "AliFlowQVectorEngine.h"
 #include "AliLog.h"
 #include "TRandom.h"
 #include "TF1.h"
@@ -149,6 +150,7 @@ fImQ(NULL),
 fSpk(NULL),
 fReQGF(NULL),
 fImQGF(NULL),
+fQVectorEngine(NULL),
 fIntFlowCorrelationsEBE(NULL),
 fIntFlowEventWeightsForCorrelationsEBE(NULL),
 fIntFlowCorrelationsAllEBE(NULL),
@@ -406,6 +408,7 @@ AliFlowAnalysisCRC::~AliFlowAnalysisCRC()
   // destructor
   delete fHistList;
   delete fTempList;
+  delete fQVectorEngine;
   if(fCRCQVecWeightsList) delete fCRCQVecWeightsList;
   if(fCRCZDCCalibList)    delete fCRCZDCCalibList;
   if(fCRCZDC2DCutList)    delete fCRCZDC2DCutList;
@@ -736,6 +739,7 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
 
   // loop over particles **********************************************************************************************
 
+  fQVectorEngine->Reset();
   for(Int_t i=0;i<nPrim;i++) {
     if(fExactNoRPs > 0 && nCounterNoRPs>fExactNoRPs){continue;}
     aftsTrack=anEvent->GetTrack(i);
@@ -809,23 +813,9 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
           if(fPhiExclZoneHist->GetBinContent(fPhiExclZoneHist->FindBin(dEta,dPhi))<0.5) continue;
         }
 
-        // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
-        for(Int_t m=0;m<12;m++) // to be improved - hardwired 6
-        {
-          for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-          {
-            (*fReQ)(m,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi);
-            (*fImQ)(m,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi);
-          }
-        }
-        // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
-        for(Int_t p=0;p<8;p++)
-        {
-          for(Int_t k=0;k<9;k++)
-          {
-            (*fSpk)(p,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k);
-          }
-        }
+        // Buffer phi and weight for Re[Q_{m*n,k}], Im[Q_{m*n,k}] and S_{p,k} (m = 1,2,...,12, k = 0,1,...,8),
+        // the sums are calculated after the loop over data bellow:
+        fQVectorEngine->AddParticle(dPhi,wPhiEta*wPhi*wPt*wEta*wTrack);
         // Differential flow:
         if(fCalculateDiffFlow || fCalculate2DDiffFlow)
         {
@@ -1220,7 +1210,8 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
 
   // ************************************************************************************************************
 
-  // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
+  // e) Calculate Q_{m*n,k} and the sums for S_{p,k} from buffered particles and the final expressions for S_{p,k} and s_{p,k} (important !!!!):
+  fQVectorEngine->Calculate(n,fReQ,fImQ,fSpk);
   for(Int_t p=0;p<8;p++)
   {
     for(Int_t k=0;k<9;k++)
@@ -2455,6 +2446,7 @@ void AliFlowAnalysisCRC::BookEverythingForIntegratedFlow()
   fReQ = new TMatrixD(12,9);
   fImQ = new TMatrixD(12,9);
   fSpk = new TMatrixD(8,9);
+  fQVectorEngine = new AliFlowQVectorEngine();
   fReQGF = new TMatrixD(21,9);
   fImQGF = new TMatrixD(21,9);
   // average correlations <2>, <4>, <6> and <8> for single event (bining is the same as in fIntFlowCorrelationsPro and fIntFlowCorrelationsHist):
@@ -43,6 +43,8 @@
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
 #include "AliFlowAnalysisWithQCumulants.h"
+#include "AliFlowQVectorEngine.h"
+#include "AliFlowBinnedQVectors.h"
 #include "TArrayD.h"
 #include "TRandom.h"
 #include "TF1.h"
@@ -137,6 +139,7 @@ AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants():
  fReQ(NULL),
  fImQ(NULL),
  fSpk(NULL),
+ fQVectorEngine(NULL),
  fIntFlowCorrelationsEBE(NULL),
  fIntFlowEventWeightsForCorrelationsEBE(NULL),
  fIntFlowCorrelationsAllEBE(NULL),
@@ -271,6 +274,9 @@ AliFlowAnalysisWithQCumulants::~AliFlowAnalysisWithQCumulants()
  // destructor
  
  delete fHistList;
+ delete fQVectorEngine;
+ for(Int_t pe=0;pe<2;pe++){delete fDiffFlowQVectorsEBE[pe];}
+ delete f2DDiffFlowQVectorsEBE;
 
 } // end of AliFlowAnalysisWithQCumulants::~AliFlowAnalysisWithQCumulants()
 
@@ -369,6 +375,9 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  fReferenceMultiplicityEBE = anEvent->GetReferenceMultiplicity(); // reference multiplicity for current event
  //Printf("Reference multiplicity (QC): %.1f",fReferenceMultiplicityEBE);
  Double_t ptEta[2] = {0.,0.}; // 0 = dPt, 1 = dEta
+ Double_t dCosnPhi[4] = {0.}; // cos((m+1)*n*dPhi) for differential flow, m = 0,1,2,3
+ Double_t dSinnPhi[4] = {0.}; // sin((m+1)*n*dPhi) for differential flow, m = 0,1,2,3
+ Double_t dWeightPowers[9] = {0.}; // (wPhi*wPt*wEta*wTrack)^k for differential flow, k = 0,1,...,8
   
  // c) Fill the common control histograms and call the method to fill fAvMultiplicity:
  this->FillCommonControlHistograms(anEvent);                                                               
@@ -379,6 +388,7 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
  AliFlowTrackSimple *aftsTrack = NULL;
  Int_t n = fHarmonic; // shortcut for the harmonic 
+ fQVectorEngine->Reset();
  for(Int_t i=0;i<nPrim;i++) 
  { 
   if(fExactNoRPs > 0 && nCounterNoRPs>fExactNoRPs){continue;}
@@ -409,87 +419,43 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      wTrack = aftsTrack->Weight(); 
     }
-    // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
-    for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
-    {
-     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     {
-      (*fReQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi); 
-      (*fImQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi); 
-     } 
-    }
-    // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
-    for(Int_t p=0;p<8;p++)
-    {
-     for(Int_t k=0;k<9;k++)
-     {     
-      (*fSpk)(p,k)+=pow(wPhi*wPt*wEta*wTrack,k);
-     }
-    } 
+    // Buffer phi and weight for Re[Q_{m*n,k}], Im[Q_{m*n,k}] and S_{p,k} (m = 1,2,...,12, k = 0,1,...,8), 
+    // the sums are calculated after the loop over data bellow:
+    fQVectorEngine->AddParticle(dPhi,wPhi*wPt*wEta*wTrack);
     // Differential flow:
     if(fCalculateDiffFlow || fCalculate2DDiffFlow)
     {
      ptEta[0] = dPt; 
      ptEta[1] = dEta; 
-     // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
-     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+     AliFlowQVectorEngine::CalculateHarmonics(dPhi,n,4,dCosnPhi,dSinnPhi);
+     AliFlowQVectorEngine::CalculateWeightPowers(wPhi*wPt*wEta*wTrack,9,dWeightPowers);
+     // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs), all m and k at once: 
+     if(fCalculateDiffFlow)
      {
-      for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+      for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
       {
-       if(fCalculateDiffFlow)
-       {
-        for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-        {
-         fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-         if(m==0) // s_{p,k} does not depend on index m
-         {
-          fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-         } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-       } // end of if(fCalculateDiffFlow) 
-       if(fCalculate2DDiffFlow)
-       {
-        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-        if(m==0) // s_{p,k} does not depend on index m
-        {
-         fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
-        } // end of if(m==0) // s_{p,k} does not depend on index m
-       } // end of if(fCalculate2DDiffFlow)
-      } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+       fDiffFlowQVectorsEBE[pe]->Fill(0,ptEta[pe],dCosnPhi,dSinnPhi,dWeightPowers,kTRUE);
+      }
+     } // end of if(fCalculateDiffFlow) 
+     if(fCalculate2DDiffFlow)
+     {
+      f2DDiffFlowQVectorsEBE->Fill(0,dPt,dEta,dCosnPhi,dSinnPhi,dWeightPowers,kTRUE);
+     } // end of if(fCalculate2DDiffFlow)
      // Checking if RP particle is also POI particle:      
      if(aftsTrack->InPOISelection())
      {
-      // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
-      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+      // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs), all m and k at once: 
+      if(fCalculateDiffFlow)
       {
-       for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+       for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
        {
-        if(fCalculateDiffFlow)
-        {
-         for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-         {
-          fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-          fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-          if(m==0) // s_{p,k} does not depend on index m
-          {
-           fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-          } // end of if(m==0) // s_{p,k} does not depend on index m
-         } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-        } // end of if(fCalculateDiffFlow) 
-        if(fCalculate2DDiffFlow)
-        {
-         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-         if(m==0) // s_{p,k} does not depend on index m
-         {
-          fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
-         } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of if(fCalculate2DDiffFlow)
-       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-      } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+        fDiffFlowQVectorsEBE[pe]->Fill(2,ptEta[pe],dCosnPhi,dSinnPhi,dWeightPowers,kTRUE);
+       }
+      } // end of if(fCalculateDiffFlow) 
+      if(fCalculate2DDiffFlow)
+      {
+       f2DDiffFlowQVectorsEBE->Fill(2,dPt,dEta,dCosnPhi,dSinnPhi,dWeightPowers,kTRUE);
+      } // end of if(fCalculate2DDiffFlow)
      } // end of if(aftsTrack->InPOISelection())  
     } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)         
    } // end of if(pTrack->InRPSelection())
@@ -521,26 +487,23 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     }
     ptEta[0] = dPt;
     ptEta[1] = dEta;
-    // Calculate p_{m*n,k} ('p-vector' for POIs): 
-    for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+    if(fCalculateDiffFlow || fCalculate2DDiffFlow)
     {
-     for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+     AliFlowQVectorEngine::CalculateHarmonics(dPhi,n,4,dCosnPhi,dSinnPhi);
+     AliFlowQVectorEngine::CalculateWeightPowers(wPhi*wPt*wEta*wTrack,9,dWeightPowers);
+    }
+    // Calculate p_{m*n,k} ('p-vector' for POIs), all m and k at once: 
+    if(fCalculateDiffFlow)
+    {
+     for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
      {
-      if(fCalculateDiffFlow)
-      {
-       for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-       {
-        fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-       } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-      } // end of if(fCalculateDiffFlow) 
-      if(fCalculate2DDiffFlow)
-      {
-       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-      } // end of if(fCalculate2DDiffFlow)
-     } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-    } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+      fDiffFlowQVectorsEBE[pe]->Fill(1,ptEta[pe],dCosnPhi,dSinnPhi,dWeightPowers,kFALSE);
+     }
+    } // end of if(fCalculateDiffFlow) 
+    if(fCalculate2DDiffFlow)
+    {
+     f2DDiffFlowQVectorsEBE->Fill(1,dPt,dEta,dCosnPhi,dSinnPhi,dWeightPowers,kFALSE);
+    } // end of if(fCalculate2DDiffFlow)
    } // end of if(pTrack->InPOISelection())    
   } else // to if(aftsTrack)
     {
@@ -548,7 +511,8 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     }
  } // end of for(Int_t i=0;i<nPrim;i++) 
 
- // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
+ // e) Calculate Q_{m*n,k} and the sums for S_{p,k} from buffered particles and the final expressions for S_{p,k} and s_{p,k} (important !!!!):
+ fQVectorEngine->Calculate(n,fReQ,fImQ,fSpk);
  for(Int_t p=0;p<8;p++)
  {
   for(Int_t k=0;k<9;k++)
@@ -1773,6 +1737,7 @@ void AliFlowAnalysisWithQCumulants::BookEverythingForIntegratedFlow()
  fReQ = new TMatrixD(12,9);
  fImQ = new TMatrixD(12,9);
  fSpk = new TMatrixD(8,9);
+ fQVectorEngine = new AliFlowQVectorEngine();
  // average correlations <2>, <4>, <6> and <8> for single event (bining is the same as in fIntFlowCorrelationsPro and fIntFlowCorrelationsHist):
  TString intFlowCorrelationsEBEName = "fIntFlowCorrelationsEBE";
  intFlowCorrelationsEBEName += fAnalysisLabel->Data();
@@ -15339,20 +15304,9 @@ void AliFlowAnalysisWithQCumulants::InitializeArraysForDiffFlow()
  
  // c) Initialize event-by-event quantities:
  // 1D:
- for(Int_t t=0;t<3;t++) // type (RP, POI, POI&&RP)
- {
-  for(Int_t pe=0;pe<2;pe++) // pt or eta
-  { 
-   for(Int_t m=0;m<4;m++) // multiple of harmonic
-   {
-    for(Int_t k=0;k<9;k++) // power of weight
-    {
-     fReRPQ1dEBE[t][pe][m][k] = NULL;
-     fImRPQ1dEBE[t][pe][m][k] = NULL;
-     fs1dEBE[t][pe][k] = NULL; // to be improved (this doesn't need to be within loop over m)
-    }   
-   }
-  }
+ for(Int_t pe=0;pe<2;pe++) // pt or eta
+ { 
+  fDiffFlowQVectorsEBE[pe] = NULL;
  }
  // 1D:
  for(Int_t t=0;t<2;t++) // type (RP or POI)
@@ -15369,18 +15323,7 @@ void AliFlowAnalysisWithQCumulants::InitializeArraysForDiffFlow()
   }
  }
  // 2D:  
- for(Int_t t=0;t<3;t++) // type (RP, POI, POI&&RP)
- {
-  for(Int_t m=0;m<4;m++) // multiple of harmonic
-  {
-   for(Int_t k=0;k<9;k++) // power of weight
-   {
-    fReRPQ2dEBE[t][m][k] = NULL;
-    fImRPQ2dEBE[t][m][k] = NULL;
-    fs2dEBE[t][k] = NULL; // to be improved (this doesn't need to be within loop over m)
-   }   
-  }
- }
+ f2DDiffFlowQVectorsEBE = NULL;
  
  // d) Initialize profiles:
  for(Int_t t=0;t<2;t++) // type: RP or POI
@@ -16619,41 +16562,31 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelations(TString type,
   if(type == "POI")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[2][pe][0][0]->GetBinContent(fReRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[2][pe][0][0]->GetBinContent(fImRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][0]->GetBinEntries(fImRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[2][pe][1][0]->GetBinContent(fReRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][0]->GetBinEntries(fReRPQ1dEBE[2][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[2][pe][1][0]->GetBinContent(fImRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][0]->GetBinEntries(fImRPQ1dEBE[2][pe][1][0]->GetBin(b));         
+   q1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,0,0,b);
+   q1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,0,0,b);
+   q2n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,1,0,b);
+   q2n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,1,0,b);         
                  
-   mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mq = fDiffFlowQVectorsEBE[pe]->GetM(2,b); // to be improved (cross-checked by accessing other profiles here)
   } 
   else if(type == "RP")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[0][pe][1][0]->GetBinContent(fReRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][1][0]->GetBinEntries(fReRPQ1dEBE[0][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[0][pe][1][0]->GetBinContent(fImRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][1][0]->GetBinEntries(fImRPQ1dEBE[0][pe][1][0]->GetBin(b));         
+   q1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,0,0,b);
+   q1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,0,0,b);
+   q2n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,1,0,b);
+   q2n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,1,0,b);         
                  
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)  
+   mq = fDiffFlowQVectorsEBE[pe]->GetM(0,b); // to be improved (cross-checked by accessing other profiles here)  
   }
       
    if(type == "POI")
    {
     // p_{m*n,0}:
-    p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-            * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-    p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-            * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
+    p1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(1,0,0,b);
+    p1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(1,0,0,b);
             
-    mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+    mp = fDiffFlowQVectorsEBE[pe]->GetM(1,b); // to be improved (cross-checked by accessing other profiles here)
     
     //t = 1; // typeFlag = RP or POI
    }
@@ -16833,49 +16766,35 @@ void AliFlowAnalysisWithQCumulants::CalculateOtherDiffCorrelators(TString type,
   if(type == "POI")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[2][pe][0][0]->GetBinContent(fReRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[2][pe][0][0]->GetBinContent(fImRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][0]->GetBinEntries(fImRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[2][pe][1][0]->GetBinContent(fReRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][0]->GetBinEntries(fReRPQ1dEBE[2][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[2][pe][1][0]->GetBinContent(fImRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][0]->GetBinEntries(fImRPQ1dEBE[2][pe][1][0]->GetBin(b));                         
-   q3n0kRe = fReRPQ1dEBE[2][pe][2][0]->GetBinContent(fReRPQ1dEBE[2][pe][2][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][2][0]->GetBinEntries(fReRPQ1dEBE[2][pe][2][0]->GetBin(b));
-   q3n0kIm = fImRPQ1dEBE[2][pe][2][0]->GetBinContent(fImRPQ1dEBE[2][pe][2][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][2][0]->GetBinEntries(fImRPQ1dEBE[2][pe][2][0]->GetBin(b));         
-
-   mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   q1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,0,0,b);
+   q1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,0,0,b);
+   q2n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,1,0,b);
+   q2n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,1,0,b);                         
+   q3n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,2,0,b);
+   q3n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,2,0,b);         
+
+   mq = fDiffFlowQVectorsEBE[pe]->GetM(2,b); // to be improved (cross-checked by accessing other profiles here)
   } 
   else if(type == "RP")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[0][pe][1][0]->GetBinContent(fReRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][1][0]->GetBinEntries(fReRPQ1dEBE[0][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[0][pe][1][0]->GetBinContent(fImRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][1][0]->GetBinEntries(fImRPQ1dEBE[0][pe][1][0]->GetBin(b));         
-   q3n0kRe = fReRPQ1dEBE[0][pe][2][0]->GetBinContent(fReRPQ1dEBE[0][pe][2][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][2][0]->GetBinEntries(fReRPQ1dEBE[0][pe][2][0]->GetBin(b));
-   q3n0kIm = fImRPQ1dEBE[0][pe][2][0]->GetBinContent(fImRPQ1dEBE[0][pe][2][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][2][0]->GetBinEntries(fImRPQ1dEBE[0][pe][2][0]->GetBin(b));         
+   q1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,0,0,b);
+   q1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,0,0,b);
+   q2n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,1,0,b);
+   q2n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,1,0,b);         
+   q3n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,2,0,b);
+   q3n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,2,0,b);         
                  
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)  
+   mq = fDiffFlowQVectorsEBE[pe]->GetM(0,b); // to be improved (cross-checked by accessing other profiles here)  
   }
       
    if(type == "POI")
    {
     // p_{m*n,0}:
-    p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-            * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-    p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-            * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
+    p1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(1,0,0,b);
+    p1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(1,0,0,b);
             
-    mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+    mp = fDiffFlowQVectorsEBE[pe]->GetM(1,b); // to be improved (cross-checked by accessing other profiles here)
     
     t = 1; // typeFlag = RP or POI
    }
@@ -16972,40 +16891,30 @@ void AliFlowAnalysisWithQCumulants::Calculate2DDiffFlowCorrelations(TString type
    if(type == "POI")
    {
     // q_{m*n,0}:
-    q1n0kRe = fReRPQ2dEBE[2][0][0]->GetBinContent(fReRPQ2dEBE[2][0][0]->GetBin(p,e))
-            * fReRPQ2dEBE[2][0][0]->GetBinEntries(fReRPQ2dEBE[2][0][0]->GetBin(p,e));
-    q1n0kIm = fImRPQ2dEBE[2][0][0]->GetBinContent(fImRPQ2dEBE[2][0][0]->GetBin(p,e))
-            * fImRPQ2dEBE[2][0][0]->GetBinEntries(fImRPQ2dEBE[2][0][0]->GetBin(p,e));
-    q2n0kRe = fReRPQ2dEBE[2][1][0]->GetBinContent(fReRPQ2dEBE[2][1][0]->GetBin(p,e))
-            * fReRPQ2dEBE[2][1][0]->GetBinEntries(fReRPQ2dEBE[2][1][0]->GetBin(p,e));
-    q2n0kIm = fImRPQ2dEBE[2][1][0]->GetBinContent(fImRPQ2dEBE[2][1][0]->GetBin(p,e))
-            * fImRPQ2dEBE[2][1][0]->GetBinEntries(fImRPQ2dEBE[2][1][0]->GetBin(p,e));         
+    q1n0kRe = f2DDiffFlowQVectorsEBE->GetReQ(2,0,0,p,e);
+    q1n0kIm = f2DDiffFlowQVectorsEBE->GetImQ(2,0,0,p,e);
+    q2n0kRe = f2DDiffFlowQVectorsEBE->GetReQ(2,1,0,p,e);
+    q2n0kIm = f2DDiffFlowQVectorsEBE->GetImQ(2,1,0,p,e);         
     // m_{q}:             
-    mq = fReRPQ2dEBE[2][0][0]->GetBinEntries(fReRPQ2dEBE[2][0][0]->GetBin(p,e)); // to be improved (cross-checked by accessing other profiles here)
+    mq = f2DDiffFlowQVectorsEBE->GetM(2,p,e); // to be improved (cross-checked by accessing other profiles here)
    } // end of if(type == "POI")
    else if(type == "RP")
    {
     // q_{m*n,0}:
-    q1n0kRe = fReRPQ2dEBE[0][0][0]->GetBinContent(fReRPQ2dEBE[0][0][0]->GetBin(p,e))
-            * fReRPQ2dEBE[0][0][0]->GetBinEntries(fReRPQ2dEBE[0][0][0]->GetBin(p,e));
-    q1n0kIm = fImRPQ2dEBE[0][0][0]->GetBinContent(fImRPQ2dEBE[0][0][0]->GetBin(p,e))
-            * fImRPQ2dEBE[0][0][0]->GetBinEntries(fImRPQ2dEBE[0][0][0]->GetBin(p,e));
-    q2n0kRe = fReRPQ2dEBE[0][1][0]->GetBinContent(fReRPQ2dEBE[0][1][0]->GetBin(p,e))
-            * fReRPQ2dEBE[0][1][0]->GetBinEntries(fReRPQ2dEBE[0][1][0]->GetBin(p,e));
-    q2n0kIm = fImRPQ2dEBE[0][1][0]->GetBinContent(fImRPQ2dEBE[0][1][0]->GetBin(p,e))
-            * fImRPQ2dEBE[0][1][0]->GetBinEntries(fImRPQ2dEBE[0][1][0]->GetBin(p,e));         
+    q1n0kRe = f2DDiffFlowQVectorsEBE->GetReQ(0,0,0,p,e);
+    q1n0kIm = f2DDiffFlowQVectorsEBE->GetImQ(0,0,0,p,e);
+    q2n0kRe = f2DDiffFlowQVectorsEBE->GetReQ(0,1,0,p,e);
+    q2n0kIm = f2DDiffFlowQVectorsEBE->GetImQ(0,1,0,p,e);         
     // m_{q}:             
-    mq = fReRPQ2dEBE[0][0][0]->GetBinEntries(fReRPQ2dEBE[0][0][0]->GetBin(p,e)); // to be improved (cross-checked by accessing other profiles here)  
+    mq = f2DDiffFlowQVectorsEBE->GetM(0,p,e); // to be improved (cross-checked by accessing other profiles here)  
    } // end of else if(type == "RP")
    if(type == "POI")
    {
     // p_{m*n,0}:
-    p1n0kRe = fReRPQ2dEBE[1][0][0]->GetBinContent(fReRPQ2dEBE[1][0][0]->GetBin(p,e))
-            * fReRPQ2dEBE[1][0][0]->GetBinEntries(fReRPQ2dEBE[1][0][0]->GetBin(p,e));
-    p1n0kIm = fImRPQ2dEBE[1][0][0]->GetBinContent(fImRPQ2dEBE[1][0][0]->GetBin(p,e))  
-            * fImRPQ2dEBE[1][0][0]->GetBinEntries(fImRPQ2dEBE[1][0][0]->GetBin(p,e));
+    p1n0kRe = f2DDiffFlowQVectorsEBE->GetReQ(1,0,0,p,e);
+    p1n0kIm = f2DDiffFlowQVectorsEBE->GetImQ(1,0,0,p,e);
     // m_{p}        
-    mp = fReRPQ2dEBE[1][0][0]->GetBinEntries(fReRPQ2dEBE[1][0][0]->GetBin(p,e)); // to be improved (cross-checked by accessing other profiles here)
+    mp = f2DDiffFlowQVectorsEBE->GetM(1,p,e); // to be improved (cross-checked by accessing other profiles here)
     
     t = 1; // typeFlag = RP or POI
    } // end of if(type == "POI")
@@ -17112,23 +17021,11 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights(TString t
  //Double_t maxPtEta[2] = {fPtMax,fEtaMax};
  Double_t binWidthPtEta[2] = {fPtBinWidth,fEtaBinWidth};
  
- for(Int_t rpq=0;rpq<3;rpq++)
+ if(!fDiffFlowQVectorsEBE[pe])
  {
-  for(Int_t m=0;m<4;m++)
-  {
-   for(Int_t k=0;k<9;k++)
-   {
-    if(!fReRPQ1dEBE[rpq][pe][m][k])
-    {
-     cout<<"WARNING: fReRPQ1dEBE[rpq][pe][m][k] is NULL in AFAWQC::CSAPOEWFDF() !!!!"<<endl;
-     cout<<"pe  = "<<pe<<endl;
-     cout<<"rpq = "<<rpq<<endl;
-     cout<<"m   = "<<m<<endl;
-     cout<<"k   = "<<k<<endl;
-     exit(0); 
-    }
-   }
-  }
+  cout<<"WARNING: fDiffFlowQVectorsEBE[pe] is NULL in AFAWQC::CSAPOEWFDF() !!!!"<<endl;
+  cout<<"pe  = "<<pe<<endl;
+  exit(0); 
  }  
 
  // multiplicities:
@@ -17148,12 +17045,12 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights(TString t
  {
   if(type == "RP")
   {
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(b);
+   mq = fDiffFlowQVectorsEBE[pe]->GetM(0,b);
    mp = mq; // trick to use the very same Eqs. bellow both for RP's and POI's diff. flow
   } else if(type == "POI")
     {
-     mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(b);
-     mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(b);    
+     mp = fDiffFlowQVectorsEBE[pe]->GetM(1,b);
+     mq = fDiffFlowQVectorsEBE[pe]->GetM(2,b);    
     }
   
   // event weight for <2'>:
@@ -17225,23 +17122,11 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(
  Double_t binWidthPtEta[2] = {fPtBinWidth,fEtaBinWidth};
  
  // protection:
- for(Int_t rpq=0;rpq<3;rpq++)
+ if(!fDiffFlowQVectorsEBE[pe])
  {
-  for(Int_t m=0;m<4;m++)
-  {
-   for(Int_t k=0;k<9;k++)
-   {
-    if(!fReRPQ1dEBE[rpq][pe][m][k])
-    {
-     cout<<"WARNING: fReRPQ1dEBE[rpq][pe][m][k] is NULL in AFAWQC::CSAPOEWFDF() !!!!"<<endl;
-     cout<<"pe  = "<<pe<<endl;
-     cout<<"rpq = "<<rpq<<endl;
-     cout<<"m   = "<<m<<endl;
-     cout<<"k   = "<<k<<endl;
-     exit(0); 
-    }
-   }
-  }
+  cout<<"WARNING: fDiffFlowQVectorsEBE[pe] is NULL in AFAWQC::CSAPOEWFDF() !!!!"<<endl;
+  cout<<"pe  = "<<pe<<endl;
+  exit(0); 
  }  
  
  // multiplicities:
@@ -17267,12 +17152,12 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(
  {
   if(type == "RP")
   {
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(b);
+   mq = fDiffFlowQVectorsEBE[pe]->GetM(0,b);
    mp = mq; // trick to use the very same Eqs. bellow both for RP's and POI's diff. flow
   } else if(type == "POI")
     {
-     mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(b);
-     mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(b);    
+     mp = fDiffFlowQVectorsEBE[pe]->GetM(1,b);
+     mq = fDiffFlowQVectorsEBE[pe]->GetM(2,b);    
     }
   
   // event weight for <2'>:
@@ -17513,12 +17398,12 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowProductOfCorrelations(TStri
   // to be improved (I should not do this here again)
   if(type == "RP")
   {
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(b);
+   mq = fDiffFlowQVectorsEBE[pe]->GetM(0,b);
    mp = mq; // trick to use the very same Eqs. bellow both for RP's and POI's diff. flow
   } else if(type == "POI")
     {
-     mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(b);
-     mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(b);    
+     mp = fDiffFlowQVectorsEBE[pe]->GetM(1,b);
+     mq = fDiffFlowQVectorsEBE[pe]->GetM(2,b);    
     }
   
   // event weights for reduced correlations:
@@ -19368,27 +19253,7 @@ void AliFlowAnalysisWithQCumulants::BookEverythingFor2DDifferentialFlow()
  TString differentialFlowIndex[4] = {"v'{2}","v'{4}","v'{6}","v'{8}"};  
   
  // b) Book e-b-e quantities: 
- TProfile2D styleRe("typeMultiplePowerRe","typeMultiplePowerRe",fnBinsPt,fPtMin,fPtMax,fnBinsEta,fEtaMin,fEtaMax);
- TProfile2D styleIm("typeMultiplePowerIm","typeMultiplePowerIm",fnBinsPt,fPtMin,fPtMax,fnBinsEta,fEtaMin,fEtaMax);
- for(Int_t t=0;t<3;t++) // typeFlag (0 = RP, 1 = POI, 2 = RP&&POI )
- { 
-  for(Int_t m=0;m<4;m++)
-  {
-   for(Int_t k=0;k<9;k++)
-   {
-    fReRPQ2dEBE[t][m][k] = (TProfile2D*)styleRe.Clone(Form("typeFlag%dmultiple%dpower%dRe",t,m,k)); 
-    fImRPQ2dEBE[t][m][k] = (TProfile2D*)styleIm.Clone(Form("typeFlag%dmultiple%dpower%dIm",t,m,k));
-   }
-  } 
- } 
- TProfile2D styleS("typePower","typePower",fnBinsPt,fPtMin,fPtMax,fnBinsEta,fEtaMin,fEtaMax);
- for(Int_t t=0;t<3;t++) // typeFlag (0 = RP, 1 = POI, 2 = RP&&POI )
- { 
-  for(Int_t k=0;k<9;k++)
-  {
-   fs2dEBE[t][k] = (TProfile2D*)styleS.Clone(Form("typeFlag%dpower%d",t,k));
-  }
- }
+ f2DDiffFlowQVectorsEBE = new AliFlowBinnedQVectors(fnBinsPt,fPtMin,fPtMax,fnBinsEta,fEtaMin,fEtaMax);
 
  // c) Book 2D profiles:
  TString s2DDiffFlowCorrelationsProName = "f2DDiffFlowCorrelationsPro";
@@ -19485,34 +19350,13 @@ void AliFlowAnalysisWithQCumulants::BookEverythingForDifferentialFlow()
  //  5.) q_{m*n,k}(pt,eta) = Q-vector evaluated in harmonic m*n for particles which are both RPs and POIs in particular (pt,eta) bin 
  //                          (i-th RP&&POI is weighted with w_i^k)            
   
+ //  6.) s_{1,k}(pt,eta) = sum of weights w_i^k of RPs, POIs or RP&&POIs in particular (pt,eta) bin.
+ // All of them are kept in flat per-bin accumulators (only the bins filled in the event are cleared).
+  
  // 1D:
- for(Int_t t=0;t<3;t++) // typeFlag (0 = RP, 1 = POI, 2 = RP && POI )
- { 
-  for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-  {
-   for(Int_t m=0;m<4;m++) // multiple of harmonic
-   {
-    for(Int_t k=0;k<9;k++) // power of particle weight
-    {
-     fReRPQ1dEBE[t][pe][m][k] = new TProfile(Form("TypeFlag%dpteta%dmultiple%dpower%dRe",t,pe,m,k),
-                                             Form("TypeFlag%dpteta%dmultiple%dpower%dRe",t,pe,m,k),nBinsPtEta[pe],minPtEta[pe],maxPtEta[pe]); 
-     fImRPQ1dEBE[t][pe][m][k] = new TProfile(Form("TypeFlag%dpteta%dmultiple%dpower%dIm",t,pe,m,k),
-                                             Form("TypeFlag%dpteta%dmultiple%dpower%dIm",t,pe,m,k),nBinsPtEta[pe],minPtEta[pe],maxPtEta[pe]); 
-    }
-   }
-  }
- } 
- // to be improved (add explanation of fs1dEBE[t][pe][k]):   
- for(Int_t t=0;t<3;t++) // typeFlag (0 = RP, 1 = POI, 2 = RP&&POI )
- { 
-  for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-  {
-   for(Int_t k=0;k<9;k++) // power of particle weight
-   {
-    fs1dEBE[t][pe][k] = new TProfile(Form("TypeFlag%dpteta%dmultiple%d",t,pe,k),
-                                     Form("TypeFlag%dpteta%dmultiple%d",t,pe,k),nBinsPtEta[pe],minPtEta[pe],maxPtEta[pe]); 
-   }
-  }
+ for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+ {
+  fDiffFlowQVectorsEBE[pe] = new AliFlowBinnedQVectors(nBinsPtEta[pe],minPtEta[pe],maxPtEta[pe]);
  }
  // correction terms for nua:
  for(Int_t t=0;t<2;t++) // typeFlag (0 = RP, 1 = POI)
@@ -20829,29 +20673,23 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWe
  
   if(type == "POI")
   {
-   p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-           * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
+   p1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(1,0,0,b);
+   p1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(1,0,0,b);
             
-   mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mp = fDiffFlowQVectorsEBE[pe]->GetM(1,b); // to be improved (cross-checked by accessing other profiles here)
     
    t = 1; // typeFlag = RP or POI
     
    // q_{m*n,k}: (Remark: m=1 is 0, k=0 iz zero (to be improved!)) 
-   q1n2kRe = fReRPQ1dEBE[2][pe][0][2]->GetBinContent(fReRPQ1dEBE[2][pe][0][2]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][2]->GetBinEntries(fReRPQ1dEBE[2][pe][0][2]->GetBin(b));
-   q1n2kIm = fImRPQ1dEBE[2][pe][0][2]->GetBinContent(fImRPQ1dEBE[2][pe][0][2]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][2]->GetBinEntries(fImRPQ1dEBE[2][pe][0][2]->GetBin(b));
-   q2n1kRe = fReRPQ1dEBE[2][pe][1][1]->GetBinContent(fReRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][1]->GetBinEntries(fReRPQ1dEBE[2][pe][1][1]->GetBin(b));
-   q2n1kIm = fImRPQ1dEBE[2][pe][1][1]->GetBinContent(fImRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][1]->GetBinEntries(fImRPQ1dEBE[2][pe][1][1]->GetBin(b));
+   q1n2kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,0,2,b);
+   q1n2kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,0,2,b);
+   q2n1kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,1,1,b);
+   q2n1kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,1,1,b);
        
    // s_{1,1}, s_{1,2} and s_{1,3} // to be improved (add explanation)  
-   s1p1k = pow(fs1dEBE[2][pe][1]->GetBinContent(b)*fs1dEBE[2][pe][1]->GetBinEntries(b),1.); 
-   s1p2k = pow(fs1dEBE[2][pe][2]->GetBinContent(b)*fs1dEBE[2][pe][2]->GetBinEntries(b),1.); 
-   s1p3k = pow(fs1dEBE[2][pe][3]->GetBinContent(b)*fs1dEBE[2][pe][3]->GetBinEntries(b),1.); 
+   s1p1k = pow(fDiffFlowQVectorsEBE[pe]->GetS(2,1,b),1.); 
+   s1p2k = pow(fDiffFlowQVectorsEBE[pe]->GetS(2,2,b),1.); 
+   s1p3k = pow(fDiffFlowQVectorsEBE[pe]->GetS(2,3,b),1.); 
      
    // M0111 from Eq. (118) in QC2c (to be improved (notation)):
    dM0111 = mp*(dSM3p1k-3.*dSM1p1k*dSM1p2k+2.*dSM1p3k)
@@ -20861,27 +20699,21 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWe
    else if(type == "RP")
    {
     // q_{m*n,k}: (Remark: m=1 is 0, k=0 iz zero (to be improved!)) 
-    q1n2kRe = fReRPQ1dEBE[0][pe][0][2]->GetBinContent(fReRPQ1dEBE[0][pe][0][2]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][0][2]->GetBinEntries(fReRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    q1n2kIm = fImRPQ1dEBE[0][pe][0][2]->GetBinContent(fImRPQ1dEBE[0][pe][0][2]->GetBin(b))
-            * fImRPQ1dEBE[0][pe][0][2]->GetBinEntries(fImRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    q2n1kRe = fReRPQ1dEBE[0][pe][1][1]->GetBinContent(fReRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][1][1]->GetBinEntries(fReRPQ1dEBE[0][pe][1][1]->GetBin(b));
-    q2n1kIm = fImRPQ1dEBE[0][pe][1][1]->GetBinContent(fImRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fImRPQ1dEBE[0][pe][1][1]->GetBinEntries(fImRPQ1dEBE[0][pe][1][1]->GetBin(b));
+    q1n2kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,0,2,b);
+    q1n2kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,0,2,b);
+    q2n1kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,1,1,b);
+    q2n1kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,1,1,b);
 
     // s_{1,1}, s_{1,2} and s_{1,3} // to be improved (add explanation)  
-    s1p1k = pow(fs1dEBE[0][pe][1]->GetBinContent(b)*fs1dEBE[0][pe][1]->GetBinEntries(b),1.); 
-    s1p2k = pow(fs1dEBE[0][pe][2]->GetBinContent(b)*fs1dEBE[0][pe][2]->GetBinEntries(b),1.); 
-    s1p3k = pow(fs1dEBE[0][pe][3]->GetBinContent(b)*fs1dEBE[0][pe][3]->GetBinEntries(b),1.); 
+    s1p1k = pow(fDiffFlowQVectorsEBE[pe]->GetS(0,1,b),1.); 
+    s1p2k = pow(fDiffFlowQVectorsEBE[pe]->GetS(0,2,b),1.); 
+    s1p3k = pow(fDiffFlowQVectorsEBE[pe]->GetS(0,3,b),1.); 
     
     // to be improved (cross-checked):
-    p1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-    p1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))  
-            * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
+    p1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,0,0,b);
+    p1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,0,0,b);
             
-    mp = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+    mp = fDiffFlowQVectorsEBE[pe]->GetM(0,b); // to be improved (cross-checked by accessing other profiles here)
      
     t = 0; // typeFlag = RP or POI
     
@@ -21007,29 +20839,9 @@ void AliFlowAnalysisWithQCumulants::ResetEventByEventQuantities()
  // Differential flow:
  if(fCalculateDiffFlow)
  {
-  for(Int_t t=0;t<3;t++) // type (RP, POI, POI&&RP)
+  for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // 1D in pt or eta
   {
-   for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // 1D in pt or eta
-   {
-    for(Int_t m=0;m<4;m++) // multiple of harmonic
-    {
-     for(Int_t k=0;k<9;k++) // power of weight
-     {
-      if(fReRPQ1dEBE[t][pe][m][k]) fReRPQ1dEBE[t][pe][m][k]->Reset();
-      if(fImRPQ1dEBE[t][pe][m][k]) fImRPQ1dEBE[t][pe][m][k]->Reset();
-     }   
-    } 
-   }
-  } 
-  for(Int_t t=0;t<3;t++) // type (0 = RP, 1 = POI, 2 = RP&&POI )
-  { 
-   for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // 1D in pt or eta
-   {
-    for(Int_t k=0;k<9;k++)
-    {
-     if(fs1dEBE[t][pe][k]) fs1dEBE[t][pe][k]->Reset();
-    }
-   }
+   if(fDiffFlowQVectorsEBE[pe]){fDiffFlowQVectorsEBE[pe]->Clear();}
   }
   // e-b-e reduced correlations:
   for(Int_t t=0;t<2;t++) // type (0 = RP, 1 = POI)
@@ -21062,24 +20874,7 @@ void AliFlowAnalysisWithQCumulants::ResetEventByEventQuantities()
  // 2D (pt,eta)
  if(fCalculate2DDiffFlow)
  {
-  for(Int_t t=0;t<3;t++) // type (RP, POI, POI&&RP)
-  {
-   for(Int_t m=0;m<4;m++) // multiple of harmonic
-   {
-    for(Int_t k=0;k<9;k++) // power of weight
-    {
-     if(fReRPQ2dEBE[t][m][k]){fReRPQ2dEBE[t][m][k]->Reset();}
-     if(fImRPQ2dEBE[t][m][k]){fImRPQ2dEBE[t][m][k]->Reset();}
-    }   
-   }
-  }
-  for(Int_t t=0;t<3;t++) // type (0 = RP, 1 = POI, 2 = RP&&POI )
-  { 
-   for(Int_t k=0;k<9;k++)
-   {
-    if(fs2dEBE[t][k]){fs2dEBE[t][k]->Reset();}
-   }
-  }  
+  if(f2DDiffFlowQVectorsEBE){f2DDiffFlowQVectorsEBE->Clear();}
  } // end of if(fCalculate2DDiffFlow) 
 
 } // end of void AliFlowAnalysisWithQCumulants::ResetEventByEventQuantities();
@@ -21158,40 +20953,30 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(T
   if(type == "POI")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[2][pe][0][0]->GetBinContent(fReRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[2][pe][0][0]->GetBinContent(fImRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][0]->GetBinEntries(fImRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[2][pe][1][0]->GetBinContent(fReRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][0]->GetBinEntries(fReRPQ1dEBE[2][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[2][pe][1][0]->GetBinContent(fImRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][0]->GetBinEntries(fImRPQ1dEBE[2][pe][1][0]->GetBin(b));         
+   q1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,0,0,b);
+   q1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,0,0,b);
+   q2n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,1,0,b);
+   q2n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,1,0,b);         
                  
-   mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mq = fDiffFlowQVectorsEBE[pe]->GetM(2,b); // to be improved (cross-checked by accessing other profiles here)
   } 
   else if(type == "RP")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[0][pe][1][0]->GetBinContent(fReRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][1][0]->GetBinEntries(fReRPQ1dEBE[0][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[0][pe][1][0]->GetBinContent(fImRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][1][0]->GetBinEntries(fImRPQ1dEBE[0][pe][1][0]->GetBin(b));         
+   q1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,0,0,b);
+   q1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,0,0,b);
+   q2n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,1,0,b);
+   q2n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,1,0,b);         
                  
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)  
+   mq = fDiffFlowQVectorsEBE[pe]->GetM(0,b); // to be improved (cross-checked by accessing other profiles here)  
   }    
   if(type == "POI")
   {
    // p_{m*n,0}:
-   p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-           * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
+   p1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(1,0,0,b);
+   p1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(1,0,0,b);
             
-   mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mp = fDiffFlowQVectorsEBE[pe]->GetM(1,b); // to be improved (cross-checked by accessing other profiles here)
     
    t = 1; // typeFlag = RP or POI
   }
@@ -21335,40 +21120,30 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(T
   if(type == "POI")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[2][pe][0][0]->GetBinContent(fReRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[2][pe][0][0]->GetBinContent(fImRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][0]->GetBinEntries(fImRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[2][pe][1][0]->GetBinContent(fReRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][0]->GetBinEntries(fReRPQ1dEBE[2][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[2][pe][1][0]->GetBinContent(fImRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][0]->GetBinEntries(fImRPQ1dEBE[2][pe][1][0]->GetBin(b));         
+   q1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,0,0,b);
+   q1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,0,0,b);
+   q2n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,1,0,b);
+   q2n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,1,0,b);         
                  
-   mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mq = fDiffFlowQVectorsEBE[pe]->GetM(2,b); // to be improved (cross-checked by accessing other profiles here)
   } 
   else if(type == "RP")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[0][pe][1][0]->GetBinContent(fReRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][1][0]->GetBinEntries(fReRPQ1dEBE[0][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[0][pe][1][0]->GetBinContent(fImRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][1][0]->GetBinEntries(fImRPQ1dEBE[0][pe][1][0]->GetBin(b));         
+   q1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,0,0,b);
+   q1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,0,0,b);
+   q2n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,1,0,b);
+   q2n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,1,0,b);         
                  
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)  
+   mq = fDiffFlowQVectorsEBE[pe]->GetM(0,b); // to be improved (cross-checked by accessing other profiles here)  
   }    
   if(type == "POI")
   {
    // p_{m*n,0}:
-   p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-           * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
+   p1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(1,0,0,b);
+   p1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(1,0,0,b);
             
-   mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mp = fDiffFlowQVectorsEBE[pe]->GetM(1,b); // to be improved (cross-checked by accessing other profiles here)
     
    t = 1; // typeFlag = RP or POI
   }
@@ -24095,45 +23870,35 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUs
   if(type == "POI")
   {           
    // q_{m*n,k}:
-   q1n2kRe = fReRPQ1dEBE[2][pe][0][2]->GetBinContent(fReRPQ1dEBE[2][pe][0][2]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][2]->GetBinEntries(fReRPQ1dEBE[2][pe][0][2]->GetBin(b));
-   //q1n2kIm = fImRPQ1dEBE[2][pe][0][2]->GetBinContent(fImRPQ1dEBE[2][pe][0][2]->GetBin(b))
-   //        * fImRPQ1dEBE[2][pe][0][2]->GetBinEntries(fImRPQ1dEBE[2][pe][0][2]->GetBin(b));         
-   q2n1kRe = fReRPQ1dEBE[2][pe][1][1]->GetBinContent(fReRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][1]->GetBinEntries(fReRPQ1dEBE[2][pe][1][1]->GetBin(b));
-   q2n1kIm = fImRPQ1dEBE[2][pe][1][1]->GetBinContent(fImRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][1]->GetBinEntries(fImRPQ1dEBE[2][pe][1][1]->GetBin(b));         
-   //mq = fReRPQ1dEBE[2][pe][1][1]->GetBinEntries(fReRPQ1dEBE[2][pe][1][1]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   q1n2kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,0,2,b);
+   //q1n2kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,0,2,b);         
+   q2n1kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,1,1,b);
+   q2n1kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,1,1,b);         
+   //mq = fDiffFlowQVectorsEBE[pe]->GetM(2,b); // to be improved (cross-checked by accessing other profiles here)
    
-   s1p1k = pow(fs1dEBE[2][pe][1]->GetBinContent(b)*fs1dEBE[2][pe][1]->GetBinEntries(b),1.); 
-   s1p2k = pow(fs1dEBE[2][pe][2]->GetBinContent(b)*fs1dEBE[2][pe][2]->GetBinEntries(b),1.); 
+   s1p1k = pow(fDiffFlowQVectorsEBE[pe]->GetS(2,1,b),1.); 
+   s1p2k = pow(fDiffFlowQVectorsEBE[pe]->GetS(2,2,b),1.); 
   }else if(type == "RP")
    {
     // q_{m*n,k}: (Remark: m=1 is 0, k=0 iz zero (to be improved!)) 
-    q1n2kRe = fReRPQ1dEBE[0][pe][0][2]->GetBinContent(fReRPQ1dEBE[0][pe][0][2]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][0][2]->GetBinEntries(fReRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    //q1n2kIm = fImRPQ1dEBE[0][pe][0][2]->GetBinContent(fImRPQ1dEBE[0][pe][0][2]->GetBin(b))
-    //        * fImRPQ1dEBE[0][pe][0][2]->GetBinEntries(fImRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    q2n1kRe = fReRPQ1dEBE[0][pe][1][1]->GetBinContent(fReRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][1][1]->GetBinEntries(fReRPQ1dEBE[0][pe][1][1]->GetBin(b));
-    q2n1kIm = fImRPQ1dEBE[0][pe][1][1]->GetBinContent(fImRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fImRPQ1dEBE[0][pe][1][1]->GetBinEntries(fImRPQ1dEBE[0][pe][1][1]->GetBin(b));
+    q1n2kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,0,2,b);
+    //q1n2kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,0,2,b);
+    q2n1kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,1,1,b);
+    q2n1kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,1,1,b);
     // s_{1,1}, s_{1,2} and s_{1,3} // to be improved (add explanation)  
-    s1p1k = pow(fs1dEBE[0][pe][1]->GetBinContent(b)*fs1dEBE[0][pe][1]->GetBinEntries(b),1.); 
-    s1p2k = pow(fs1dEBE[0][pe][2]->GetBinContent(b)*fs1dEBE[0][pe][2]->GetBinEntries(b),1.); 
-    //s1p3k = pow(fs1dEBE[0][pe][3]->GetBinContent(b)*fs1dEBE[0][pe][3]->GetBinEntries(b),1.);  
+    s1p1k = pow(fDiffFlowQVectorsEBE[pe]->GetS(0,1,b),1.); 
+    s1p2k = pow(fDiffFlowQVectorsEBE[pe]->GetS(0,2,b),1.); 
+    //s1p3k = pow(fDiffFlowQVectorsEBE[pe]->GetS(0,3,b),1.);  
     
-    //mq = fReRPQ1dEBE[0][pe][1][1]->GetBinEntries(fReRPQ1dEBE[0][pe][1][1]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here) 
+    //mq = fDiffFlowQVectorsEBE[pe]->GetM(0,b); // to be improved (cross-checked by accessing other profiles here) 
   }    
   
   if(type == "POI")
   {
    // p_{m*n,k}:   
-   p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-           * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here) 
+   p1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(1,0,0,b);
+   p1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(1,0,0,b);
+   mp = fDiffFlowQVectorsEBE[pe]->GetM(1,b); // to be improved (cross-checked by accessing other profiles here) 
    // M01 from Eq. (118) in QC2c (to be improved (notation)):
    dM01 = mp*dSM1p1k-s1p1k;
    dM011 = mp*(dSM2p1k-dSM1p2k)
@@ -24144,11 +23909,9 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUs
   } else if(type == "RP")
     {  
      // to be improved (cross-checked):
-     p1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-             * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-     p1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))  
-             * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-     mp = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+     p1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,0,0,b);
+     p1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,0,0,b);
+     mp = fDiffFlowQVectorsEBE[pe]->GetM(0,b); // to be improved (cross-checked by accessing other profiles here)
      // M01 from Eq. (118) in QC2c (to be improved (notation)):
      dM01 = mp*dSM1p1k-s1p1k;
      dM011 = mp*(dSM2p1k-dSM1p2k)
@@ -24301,43 +24064,33 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUs
   if(type == "POI")
   {    
    // q_{m*n,k}:
-   //q1n2kRe = fReRPQ1dEBE[2][pe][0][2]->GetBinContent(fReRPQ1dEBE[2][pe][0][2]->GetBin(b))
-   //        * fReRPQ1dEBE[2][pe][0][2]->GetBinEntries(fReRPQ1dEBE[2][pe][0][2]->GetBin(b));
-   q1n2kIm = fImRPQ1dEBE[2][pe][0][2]->GetBinContent(fImRPQ1dEBE[2][pe][0][2]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][2]->GetBinEntries(fImRPQ1dEBE[2][pe][0][2]->GetBin(b));         
-   q2n1kRe = fReRPQ1dEBE[2][pe][1][1]->GetBinContent(fReRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][1]->GetBinEntries(fReRPQ1dEBE[2][pe][1][1]->GetBin(b));
-   q2n1kIm = fImRPQ1dEBE[2][pe][1][1]->GetBinContent(fImRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][1]->GetBinEntries(fImRPQ1dEBE[2][pe][1][1]->GetBin(b));         
-   //mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   //q1n2kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,0,2,b);
+   q1n2kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,0,2,b);         
+   q2n1kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(2,1,1,b);
+   q2n1kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(2,1,1,b);         
+   //mq = fDiffFlowQVectorsEBE[pe]->GetM(2,b); // to be improved (cross-checked by accessing other profiles here)
    
-   s1p1k = pow(fs1dEBE[2][pe][1]->GetBinContent(b)*fs1dEBE[2][pe][1]->GetBinEntries(b),1.); 
-   s1p2k = pow(fs1dEBE[2][pe][2]->GetBinContent(b)*fs1dEBE[2][pe][2]->GetBinEntries(b),1.); 
+   s1p1k = pow(fDiffFlowQVectorsEBE[pe]->GetS(2,1,b),1.); 
+   s1p2k = pow(fDiffFlowQVectorsEBE[pe]->GetS(2,2,b),1.); 
   }else if(type == "RP")
    {
     // q_{m*n,k}: (Remark: m=1 is 0, k=0 iz zero (to be improved!)) 
-    //q1n2kRe = fReRPQ1dEBE[0][pe][0][2]->GetBinContent(fReRPQ1dEBE[0][pe][0][2]->GetBin(b))
-    //        * fReRPQ1dEBE[0][pe][0][2]->GetBinEntries(fReRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    q1n2kIm = fImRPQ1dEBE[0][pe][0][2]->GetBinContent(fImRPQ1dEBE[0][pe][0][2]->GetBin(b))
-            * fImRPQ1dEBE[0][pe][0][2]->GetBinEntries(fImRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    q2n1kRe = fReRPQ1dEBE[0][pe][1][1]->GetBinContent(fReRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][1][1]->GetBinEntries(fReRPQ1dEBE[0][pe][1][1]->GetBin(b));
-    q2n1kIm = fImRPQ1dEBE[0][pe][1][1]->GetBinContent(fImRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fImRPQ1dEBE[0][pe][1][1]->GetBinEntries(fImRPQ1dEBE[0][pe][1][1]->GetBin(b));
+    //q1n2kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,0,2,b);
+    q1n2kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,0,2,b);
+    q2n1kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,1,1,b);
+    q2n1kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,1,1,b);
     // s_{1,1}, s_{1,2} and s_{1,3} // to be improved (add explanation)  
-    s1p1k = pow(fs1dEBE[0][pe][1]->GetBinContent(b)*fs1dEBE[0][pe][1]->GetBinEntries(b),1.); 
-    s1p2k = pow(fs1dEBE[0][pe][2]->GetBinContent(b)*fs1dEBE[0][pe][2]->GetBinEntries(b),1.); 
-    //s1p3k = pow(fs1dEBE[0][pe][3]->GetBinContent(b)*fs1dEBE[0][pe][3]->GetBinEntries(b),1.); 
+    s1p1k = pow(fDiffFlowQVectorsEBE[pe]->GetS(0,1,b),1.); 
+    s1p2k = pow(fDiffFlowQVectorsEBE[pe]->GetS(0,2,b),1.); 
+    //s1p3k = pow(fDiffFlowQVectorsEBE[pe]->GetS(0,3,b),1.); 
   }    
   
   if(type == "POI")
   {
    // p_{m*n,k}:   
-   p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-           * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here) 
+   p1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(1,0,0,b);
+   p1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(1,0,0,b);
+   mp = fDiffFlowQVectorsEBE[pe]->GetM(1,b); // to be improved (cross-checked by accessing other profiles here) 
    // M01 from Eq. (118) in QC2c (to be improved (notation)):
    dM01 = mp*dSM1p1k-s1p1k;
    dM011 = mp*(dSM2p1k-dSM1p2k)
@@ -24347,11 +24100,9 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUs
   } else if(type == "RP")
     { 
      // to be improved (cross-checked):
-     p1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-             * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-     p1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))  
-             * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-     mp = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)    
+     p1n0kRe = fDiffFlowQVectorsEBE[pe]->GetReQ(0,0,0,b);
+     p1n0kIm = fDiffFlowQVectorsEBE[pe]->GetImQ(0,0,0,b);
+     mp = fDiffFlowQVectorsEBE[pe]->GetM(0,b); // to be improved (cross-checked by accessing other profiles here)    
      // M01 from Eq. (118) in QC2c (to be improved (notation)):
      dM01 = mp*dSM1p1k-s1p1k;
      dM011 = mp*(dSM2p1k-dSM1p2k)
@@ -24930,6 +24681,11 @@ void AliFlowAnalysisWithQCumulants::CheckPointersUsedInMake()
   printf("\n WARNING (QC): fIntFlowExtraCorrelationsPro is NULL in CheckPointersUsedInMake() !!!!\n\n");
   exit(0); 
  } 
+ if(!fQVectorEngine)
+ {
+  printf("\n WARNING (QC): fQVectorEngine is NULL in CheckPointersUsedInMake() !!!!\n\n");
+  exit(0); 
+ } 
  // 2D:
  if(fCalculate2DDiffFlow)
  {
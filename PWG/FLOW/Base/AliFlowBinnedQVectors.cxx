@@ -0,0 +1,180 @@
+/*************************************************************************
+* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  * 
+**************************************************************************/
+
+#include "AliFlowBinnedQVectors.h"
+
+//********************************************************************
+// AliFlowBinnedQVectors:                                            *
+// Event-by-event r-, p- and q-vectors and s_{1,k} in pt, eta or     *
+// (pt,eta) bins for differential flow with Q-cumulants.             *
+//                                                                   *
+// Replaces the per-event TProfile/TProfile2D objects: the sums are  *
+// kept in flat arrays, a particle fills all (m,k) of its bin in one *
+// call and only the bins filled in the event are cleared. The       *
+// number of particles in a bin plays the role of GetBinEntries().   *
+//********************************************************************
+
+ClassImp(AliFlowBinnedQVectors)
+
+//________________________________________________________________________
+
+AliFlowBinnedQVectors::AliFlowBinnedQVectors():
+  TObject(),
+  fNBinsX(0),
+  fXMin(0.),
+  fXMax(0.),
+  fNBinsY(0),
+  fYMin(0.),
+  fYMax(0.),
+  fNBinsYOr1(1),
+  fNBins(0),
+  fReQ(0),
+  fImQ(0),
+  fS(0),
+  fM(0),
+  fFilledBins(0),
+  fNFilledBins(0),
+  fIsFilled(0)
+{
+  // default constructor
+}
+
+//________________________________________________________________________
+
+AliFlowBinnedQVectors::AliFlowBinnedQVectors(Int_t nBinsX, Double_t xMin, Double_t xMax, Int_t nBinsY, Double_t yMin, Double_t yMax):
+  TObject(),
+  fNBinsX(nBinsX),
+  fXMin(xMin),
+  fXMax(xMax),
+  fNBinsY(nBinsY),
+  fYMin(yMin),
+  fYMax(yMax),
+  fNBinsYOr1(nBinsY > 0 ? nBinsY : 1),
+  fNBins(0),
+  fReQ(0),
+  fImQ(0),
+  fS(0),
+  fM(0),
+  fFilledBins(0),
+  fNFilledBins(0),
+  fIsFilled(0)
+{
+  // constructor for 1D (nBinsY = 0) or 2D binning
+
+  fNBins = fNBinsX*fNBinsYOr1;
+  fReQ.Set(kNTypes*fNBins*kNHarmonics*kNPowers);
+  fImQ.Set(kNTypes*fNBins*kNHarmonics*kNPowers);
+  fS.Set(kNTypes*fNBins*kNPowers);
+  fM.Set(kNTypes*fNBins);
+  fFilledBins.Set(kNTypes*fNBins);
+  fIsFilled.Set(kNTypes*fNBins);
+}
+
+//________________________________________________________________________
+
+AliFlowBinnedQVectors::~AliFlowBinnedQVectors()
+{
+  // destructor
+}
+
+//________________________________________________________________________
+
+Int_t AliFlowBinnedQVectors::FindBin(Double_t x, Int_t nBins, Double_t min, Double_t max) const
+{
+  // bin as in TAxis::FindBin for fixed bins, -1 for underflow and overflow
+
+  if(x < min || !(x < max)){return -1;}
+  Int_t bin = 1 + (Int_t)(nBins*(x-min)/(max-min));
+  if(bin > nBins){return -1;}
+  return bin;
+}
+
+//________________________________________________________________________
+
+void AliFlowBinnedQVectors::Fill(Int_t t, Double_t x, const Double_t *cosine, const Double_t *sine, const Double_t *powers, Bool_t fillS)
+{
+  // fill 1D
+
+  Int_t binX = FindBin(x,fNBinsX,fXMin,fXMax);
+  if(binX < 0){return;}
+  FillBin(IndexM(t,binX,1),cosine,sine,powers,fillS);
+}
+
+//________________________________________________________________________
+
+void AliFlowBinnedQVectors::Fill(Int_t t, Double_t x, Double_t y, const Double_t *cosine, const Double_t *sine, const Double_t *powers, Bool_t fillS)
+{
+  // fill 2D
+
+  Int_t binX = FindBin(x,fNBinsX,fXMin,fXMax);
+  Int_t binY = FindBin(y,fNBinsY,fYMin,fYMax);
+  if(binX < 0 || binY < 0){return;}
+  FillBin(IndexM(t,binX,binY),cosine,sine,powers,fillS);
+}
+
+//________________________________________________________________________
+
+void AliFlowBinnedQVectors::FillBin(Int_t bin, const Double_t *cosine, const Double_t *sine, const Double_t *powers, Bool_t fillS)
+{
+  // add one particle to the sums of flat bin index <bin>
+
+  if(!fIsFilled.GetArray()[bin])
+  {
+    fIsFilled.GetArray()[bin] = 1;
+    fFilledBins.GetArray()[fNFilledBins++] = bin;
+  }
+  fM.GetArray()[bin] += 1.;
+
+  Double_t *reQ = fReQ.GetArray() + bin*kNHarmonics*kNPowers;
+  Double_t *imQ = fImQ.GetArray() + bin*kNHarmonics*kNPowers;
+  for(Int_t m=0;m<kNHarmonics;m++)
+  {
+    for(Int_t k=0;k<kNPowers;k++)
+    {
+      reQ[m*kNPowers+k] += powers[k]*cosine[m];
+      imQ[m*kNPowers+k] += powers[k]*sine[m];
+    }
+  }
+  if(!fillS){return;}
+  Double_t *s = fS.GetArray() + bin*kNPowers;
+  for(Int_t k=0;k<kNPowers;k++)
+  {
+    s[k] += powers[k];
+  }
+}
+
+//________________________________________________________________________
+
+void AliFlowBinnedQVectors::Clear(Option_t* /*option*/)
+{
+  // reset the bins filled in this event
+
+  for(Int_t i=0;i<fNFilledBins;i++)
+  {
+    Int_t bin = fFilledBins.GetArray()[i];
+    fIsFilled.GetArray()[bin] = 0;
+    fM.GetArray()[bin] = 0.;
+    for(Int_t mk=0;mk<kNHarmonics*kNPowers;mk++)
+    {
+      fReQ.GetArray()[bin*kNHarmonics*kNPowers+mk] = 0.;
+      fImQ.GetArray()[bin*kNHarmonics*kNPowers+mk] = 0.;
+    }
+    for(Int_t k=0;k<kNPowers;k++)
+    {
+      fS.GetArray()[bin*kNPowers+k] = 0.;
+    }
+  }
+  fNFilledBins = 0;
+}
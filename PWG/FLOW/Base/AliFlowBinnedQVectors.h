@@ -0,0 +1,69 @@
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+* See cxx source for full Copyright notice */
+/* $Id$ */
+
+#ifndef ALIFLOWBINNEDQVECTORS_H
+#define ALIFLOWBINNEDQVECTORS_H
+
+#include "TObject.h"
+#include "TArrayD.h"
+#include "TArrayI.h"
+#include "TArrayC.h"
+
+//********************************************************************
+// AliFlowBinnedQVectors:                                            *
+// Event-by-event r-, p- and q-vectors and s_{1,k} in pt, eta or     *
+// (pt,eta) bins for differential flow with Q-cumulants.             *
+//********************************************************************
+
+class AliFlowBinnedQVectors: public TObject {
+ public:
+  enum { kNTypes = 3, kNHarmonics = 4, kNPowers = 9 }; // type: 0 = RP, 1 = POI, 2 = RP&&POI
+
+  AliFlowBinnedQVectors();
+  AliFlowBinnedQVectors(Int_t nBinsX, Double_t xMin, Double_t xMax, Int_t nBinsY=0, Double_t yMin=0., Double_t yMax=0.);
+  virtual ~AliFlowBinnedQVectors();
+
+  // fill all harmonics m and powers k of one particle of type t; cosine[m], sine[m] = cos/sin((m+1)*n*phi), powers[k] = w^k:
+  void Fill(Int_t t, Double_t x, const Double_t *cosine, const Double_t *sine, const Double_t *powers, Bool_t fillS);
+  void Fill(Int_t t, Double_t x, Double_t y, const Double_t *cosine, const Double_t *sine, const Double_t *powers, Bool_t fillS);
+  virtual void Clear(Option_t *option=""); // reset only the bins filled in this event
+
+  // getters (bins start from 1 as for histograms; binY is ignored in 1D):
+  Double_t GetReQ(Int_t t, Int_t m, Int_t k, Int_t binX, Int_t binY=1) const {return fReQ.GetArray()[IndexQ(t,m,k,binX,binY)];}
+  Double_t GetImQ(Int_t t, Int_t m, Int_t k, Int_t binX, Int_t binY=1) const {return fImQ.GetArray()[IndexQ(t,m,k,binX,binY)];}
+  Double_t GetS(Int_t t, Int_t k, Int_t binX, Int_t binY=1) const {return fS.GetArray()[IndexS(t,k,binX,binY)];}
+  Double_t GetM(Int_t t, Int_t binX, Int_t binY=1) const {return fM.GetArray()[IndexM(t,binX,binY)];}
+  Int_t GetNbinsX() const {return fNBinsX;}
+  Int_t GetNbinsY() const {return fNBinsY;}
+
+ private:
+  AliFlowBinnedQVectors(const AliFlowBinnedQVectors& vectors);
+  AliFlowBinnedQVectors& operator=(const AliFlowBinnedQVectors& vectors);
+
+  Int_t FindBin(Double_t x, Int_t nBins, Double_t min, Double_t max) const;
+  void FillBin(Int_t bin, const Double_t *cosine, const Double_t *sine, const Double_t *powers, Bool_t fillS);
+  Int_t IndexM(Int_t t, Int_t binX, Int_t binY) const {return t*fNBins + (binX-1)*fNBinsYOr1 + (binY-1);}
+  Int_t IndexS(Int_t t, Int_t k, Int_t binX, Int_t binY) const {return IndexM(t,binX,binY)*kNPowers + k;}
+  Int_t IndexQ(Int_t t, Int_t m, Int_t k, Int_t binX, Int_t binY) const {return (IndexM(t,binX,binY)*kNHarmonics + m)*kNPowers + k;}
+
+  Int_t fNBinsX;       // number of bins in x (pt or eta)
+  Double_t fXMin;      // lower edge in x
+  Double_t fXMax;      // upper edge in x
+  Int_t fNBinsY;       // number of bins in y (eta), 0 for 1D
+  Double_t fYMin;      // lower edge in y
+  Double_t fYMax;      // upper edge in y
+  Int_t fNBinsYOr1;    // max(fNBinsY,1)
+  Int_t fNBins;        // number of bins per type
+  TArrayD fReQ;        //! sum_{i} w_{i}^{k} cos((m+1)*n*phi_{i}) [t][bin][m][k]
+  TArrayD fImQ;        //! sum_{i} w_{i}^{k} sin((m+1)*n*phi_{i}) [t][bin][m][k]
+  TArrayD fS;          //! sum_{i} w_{i}^{k} [t][bin][k]
+  TArrayD fM;          //! number of particles [t][bin]
+  TArrayI fFilledBins; //! indices [t][bin] filled in this event
+  Int_t fNFilledBins;  //! number of entries in fFilledBins
+  TArrayC fIsFilled;   //! flags for bins in fFilledBins [t][bin]
+
+  ClassDef(AliFlowBinnedQVectors, 1);
+};
+
+#endif
@@ -0,0 +1,159 @@
+/*************************************************************************
+* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  * 
+**************************************************************************/
+
+#include "AliFlowQVectorEngine.h"
+#include "TMatrixD.h"
+#include "TMath.h"
+
+//********************************************************************
+// AliFlowQVectorEngine:                                             *
+// Accumulates Re[Q_{m*n,k}], Im[Q_{m*n,k}] and S_{p,k} for the      *
+// Q-cumulant analyses from buffered (phi, weight) pairs.            *
+//                                                                   *
+// The particles of one event are gathered into flat arrays. In      *
+// Calculate() the harmonics (m+1)*n are obtained by angle-addition  *
+// recurrences from a single cos/sin per particle and the powers of  *
+// the weight incrementally, instead of calling cos, sin and pow for *
+// each (m,k). If all weights are 1 only k = 0 is computed.          *
+//********************************************************************
+
+ClassImp(AliFlowQVectorEngine)
+
+//________________________________________________________________________
+
+AliFlowQVectorEngine::AliFlowQVectorEngine():
+  TObject(),
+  fNParticles(0),
+  fUnitWeights(kTRUE),
+  fPhi(0),
+  fWeight(0)
+{
+  // default constructor
+}
+
+//________________________________________________________________________
+
+AliFlowQVectorEngine::~AliFlowQVectorEngine()
+{
+  // destructor
+}
+
+//________________________________________________________________________
+
+void AliFlowQVectorEngine::AddParticle(Double_t phi, Double_t weight)
+{
+  // buffer one particle; the buffers grow on demand and are reused event by event
+
+  if(fNParticles >= fPhi.GetSize())
+  {
+    Int_t newSize = TMath::Max(2*fPhi.GetSize(),1024);
+    fPhi.Set(newSize);
+    fWeight.Set(newSize);
+  }
+  fPhi.GetArray()[fNParticles] = phi;
+  fWeight.GetArray()[fNParticles] = weight;
+  if(weight != 1.){fUnitWeights = kFALSE;}
+  fNParticles++;
+}
+
+//________________________________________________________________________
+
+void AliFlowQVectorEngine::CalculateHarmonics(Double_t phi, Int_t harmonic, Int_t nHarmonics, Double_t *cosine, Double_t *sine)
+{
+  // cosine[m] = cos((m+1)*n*phi), sine[m] = sin((m+1)*n*phi) via angle addition
+
+  if(nHarmonics < 1){return;}
+  Double_t c1 = TMath::Cos(harmonic*phi);
+  Double_t s1 = TMath::Sin(harmonic*phi);
+  cosine[0] = c1;
+  sine[0] = s1;
+  for(Int_t m=1;m<nHarmonics;m++)
+  {
+    cosine[m] = cosine[m-1]*c1 - sine[m-1]*s1;
+    sine[m] = sine[m-1]*c1 + cosine[m-1]*s1;
+  }
+}
+
+//________________________________________________________________________
+
+void AliFlowQVectorEngine::CalculateWeightPowers(Double_t weight, Int_t nPowers, Double_t *powers)
+{
+  // powers[k] = weight^k
+
+  if(nPowers < 1){return;}
+  powers[0] = 1.;
+  for(Int_t k=1;k<nPowers;k++)
+  {
+    powers[k] = powers[k-1]*weight;
+  }
+}
+
+//________________________________________________________________________
+
+void AliFlowQVectorEngine::Calculate(Int_t harmonic, TMatrixD *reQ, TMatrixD *imQ, TMatrixD *spk) const
+{
+  // adds sum_{i} w_{i}^{k} cos((m+1)*n*phi_{i}) to reQ(m,k), the sin terms to imQ(m,k) and 
+  // sum_{i} w_{i}^{k} to spk(p,k) for all p (the power p+1 is taken by the caller at the end of the event)
+
+  const Int_t nHarmonics = TMath::Min(reQ->GetNrows(),(Int_t)kMaxHarmonics);
+  const Int_t nPowers = TMath::Min(reQ->GetNcols(),(Int_t)kMaxPowers);
+  // with unit weights all powers are identical, only k = 0 is computed:
+  const Int_t nPowersToCalculate = (fUnitWeights ? 1 : nPowers);
+
+  Double_t sumCos[kMaxHarmonics][kMaxPowers] = {{0.}};
+  Double_t sumSin[kMaxHarmonics][kMaxPowers] = {{0.}};
+  Double_t sumWeights[kMaxPowers] = {0.};
+  Double_t cosine[kMaxHarmonics] = {0.};
+  Double_t sine[kMaxHarmonics] = {0.};
+  Double_t powers[kMaxPowers] = {0.};
+
+  const Double_t *phi = fPhi.GetArray();
+  const Double_t *weight = fWeight.GetArray();
+  for(Int_t i=0;i<fNParticles;i++)
+  {
+    CalculateHarmonics(phi[i],harmonic,nHarmonics,cosine,sine);
+    CalculateWeightPowers(weight[i],nPowersToCalculate,powers);
+    for(Int_t m=0;m<nHarmonics;m++)
+    {
+      for(Int_t k=0;k<nPowersToCalculate;k++)
+      {
+        sumCos[m][k] += powers[k]*cosine[m];
+        sumSin[m][k] += powers[k]*sine[m];
+      }
+    }
+    for(Int_t k=0;k<nPowersToCalculate;k++)
+    {
+      sumWeights[k] += powers[k];
+    }
+  }
+
+  for(Int_t m=0;m<nHarmonics;m++)
+  {
+    for(Int_t k=0;k<nPowers;k++)
+    {
+      const Int_t kk = (fUnitWeights ? 0 : k);
+      (*reQ)(m,k) += sumCos[m][kk];
+      (*imQ)(m,k) += sumSin[m][kk];
+    }
+  }
+  if(!spk){return;}
+  for(Int_t p=0;p<spk->GetNrows();p++)
+  {
+    for(Int_t k=0;k<TMath::Min(spk->GetNcols(),nPowers);k++)
+    {
+      (*spk)(p,k) += sumWeights[fUnitWeights ? 0 : k];
+    }
+  }
+}
@@ -0,0 +1,48 @@
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+* See cxx source for full Copyright notice */
+/* $Id$ */
+
+#ifndef ALIFLOWQVECTORENGINE_H
+#define ALIFLOWQVECTORENGINE_H
+
+#include "TObject.h"
+#include "TArrayD.h"
+
+class TMatrixD;
+
+//********************************************************************
+// AliFlowQVectorEngine:                                             *
+// Accumulates Re[Q_{m*n,k}], Im[Q_{m*n,k}] and S_{p,k} for the      *
+// Q-cumulant analyses from buffered (phi, weight) pairs.            *
+//********************************************************************
+
+class AliFlowQVectorEngine: public TObject {
+ public:
+  enum { kMaxHarmonics = 12, kMaxPowers = 9 };
+
+  AliFlowQVectorEngine();
+  virtual ~AliFlowQVectorEngine();
+
+  void Reset() {fNParticles = 0; fUnitWeights = kTRUE;}  // clear the particle buffer (call once per event)
+  void AddParticle(Double_t phi, Double_t weight);        // buffer one reference particle
+  Int_t GetNParticles() const {return fNParticles;}
+
+  void Calculate(Int_t harmonic, TMatrixD *reQ, TMatrixD *imQ, TMatrixD *spk) const; // add the sums of buffered particles to Q_{m*n,k} and S_{p,k}
+
+  // helpers, also used for the per-particle p-, q- and r-vectors:
+  static void CalculateHarmonics(Double_t phi, Int_t harmonic, Int_t nHarmonics, Double_t *cosine, Double_t *sine); // cos/sin((m+1)*n*phi), m = 0,...,nHarmonics-1
+  static void CalculateWeightPowers(Double_t weight, Int_t nPowers, Double_t *powers);                             // weight^k, k = 0,...,nPowers-1
+
+ private:
+  AliFlowQVectorEngine(const AliFlowQVectorEngine& engine);
+  AliFlowQVectorEngine& operator=(const AliFlowQVectorEngine& engine);
+
+  Int_t fNParticles;    // number of buffered particles
+  Bool_t fUnitWeights;  // all buffered weights are 1
+  TArrayD fPhi;         //! azimuthal angles of buffered particles
+  TArrayD fWeight;      //! weights of buffered particles
+
+  ClassDef(AliFlowQVectorEngine, 1);
+};
+
+#endif
@@ -288,25 +288,7 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 
   // fill axis cache
   if (!axisCache)
-  {
-    axisCache = new TAxis*[fNVars];
-    fNbinsCache = new Int_t[fNVars];
-    for (Int_t i=0; i<fNVars; i++)
-    {
-      axisCache[i] = GetAxis(i, 0);
-      fNbinsCache[i] = axisCache[i]->GetNbins();
-    }
-    
-    fLastVars = new Double_t[fNVars];
-    fLastBins = new Int_t[fNVars];
-    
-    // initial values to prevent checking for 0 below
-    for (Int_t i=0; i<fNVars; i++)
-    {
-      fLastBins[i] = axisCache[i]->FindBin(var[i]);
-      fLastVars[i] = var[i];
-    }
-  }
+    InitAxisCache();
   
   // calculate global bin index
   Long64_t bin = 0;
@@ -360,6 +342,140 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //   AliCFContainer::Fill(var, istep, weight);
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::InitAxisCache()
+{
+  // caches axis pointers and number of bins per axis
+  
+  axisCache = new TAxis*[fNVars];
+  fNbinsCache = new Int_t[fNVars];
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    axisCache[i] = GetAxis(i, 0);
+    fNbinsCache[i] = axisCache[i]->GetNbins();
+  }
+  
+  fLastVars = new Double_t[fNVars];
+  fLastBins = new Int_t[fNVars];
+  
+  // initial values to prevent checking for 0 in Fill
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    fLastVars[i] = axisCache[i]->GetBinCenter(1);
+    fLastBins[i] = axisCache[i]->FindBin(fLastVars[i]);
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillN(Int_t n, const Double_t* const* columns, Int_t istep, const Double_t *weights)
+{
+  // fills <n> entries given in struct-of-arrays form
+  //   columns[i][j] is the value of variable i for entry j
+  //   weights[j] is the weight of entry j (weight 1 is assumed if weights == 0)
+  //
+  // the result is identical to calling Fill for each entry in order. The global bin indices are computed 
+  // axis by axis for batches of entries: uniform axes are resolved with a multiplication, variable 
+  // axes with a branch-free binary search on the bin edges. Both loops are free of dependencies between 
+  // entries and can be vectorized by the compiler.
+
+  if (n <= 0)
+    return;
+  
+  if (!axisCache)
+    InitAxisCache();
+  
+  Long64_t bins[kFillNBatch];
+  
+  for (Int_t offset = 0; offset < n; offset += kFillNBatch)
+  {
+    const Int_t batch = TMath::Min((Int_t) kFillNBatch, n - offset);
+    
+    for (Int_t j=0; j<batch; j++)
+      bins[j] = 0;
+    
+    // calculate global bin indices; entries in under/overflow are flagged with -1
+    for (Int_t i=0; i<fNVars; i++)
+    {
+      const Double_t* var = columns[i] + offset;
+      const Int_t nBins = fNbinsCache[i];
+      const Double_t xmin = axisCache[i]->GetXmin();
+      const Double_t xmax = axisCache[i]->GetXmax();
+      const TArrayD* edgesArray = axisCache[i]->GetXbins();
+      
+      if (edgesArray->GetSize() == 0)
+      {
+        // uniform binning, same arithmetic as TAxis::FindBin
+        const Double_t width = xmax - xmin;
+        for (Int_t j=0; j<batch; j++)
+        {
+          const Bool_t inRange = (var[j] >= xmin) && (var[j] < xmax);
+          const Long64_t tmpBin = (inRange) ? (Long64_t) (nBins * (var[j] - xmin) / width) : -1;
+          // rounding can put values just below xmax into the overflow bin, as in TAxis::FindBin
+          bins[j] = (bins[j] < 0 || tmpBin < 0 || tmpBin >= nBins) ? -1 : bins[j] * nBins + tmpBin;
+        }
+      }
+      else
+      {
+        // variable binning, lower bound search on the bin edges (same result as TMath::BinarySearch)
+        const Double_t* edges = edgesArray->GetArray();
+        for (Int_t j=0; j<batch; j++)
+        {
+          const Bool_t inRange = (var[j] >= xmin) && (var[j] < xmax);
+          Int_t base = 0;
+          Int_t len = nBins + 1;
+          while (len > 1)
+          {
+            const Int_t half = len / 2;
+            base = (edges[base + half] <= var[j]) ? base + half : base;
+            len -= half;
+          }
+          bins[j] = (bins[j] < 0 || !inRange) ? -1 : bins[j] * nBins + base;
+        }
+      }
+    }
+    
+    if (!fValues[istep])
+    {
+      fValues[istep] = new TemplateArray(fNBins);
+      AliInfo(Form("Created values container for step %d", istep));
+    }
+    
+    TemplateType* values = fValues[istep]->GetArray();
+    
+    if (!weights)
+    {
+      TemplateType* sumw2 = (fSumw2[istep]) ? fSumw2[istep]->GetArray() : 0;
+      for (Int_t j=0; j<batch; j++)
+      {
+        if (bins[j] < 0)
+          continue;
+        values[bins[j]] += 1;
+        if (sumw2)
+          sumw2[bins[j]] += 1;
+      }
+      continue;
+    }
+    
+    const Double_t* weight = weights + offset;
+    for (Int_t j=0; j<batch; j++)
+    {
+      if (bins[j] < 0)
+        continue;
+
+      if (weight[j] != 1 && !fSumw2[istep])
+      {
+        // initialize with already filled entries (which have been filled with weight == 1), in this case fSumw2 := fValues
+        fSumw2[istep] = new TemplateArray(*fValues[istep]);
+        AliInfo(Form("Created sumw2 container for step %d", istep));
+      }
+      
+      values[bins[j]] += weight[j];
+      if (fSumw2[istep])
+        fSumw2[istep]->GetArray()[bins[j]] += weight[j] * weight[j];
+    }
+  }
+}
+
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* binIdx)
 {
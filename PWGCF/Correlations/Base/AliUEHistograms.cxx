@@ -36,6 +36,10 @@
 #include "TH3F.h"
 #include "TMath.h"
 #include "TLorentzVector.h"
+#include "TArrayC.h"
+#include "TArrayD.h"
+#include "TArrayF.h"
+#include "TArrayS.h"
 
 ClassImp(AliUEHistograms)
 
@@ -428,6 +432,75 @@ Int_t AliUEHistograms::CountParticles(TList* list, Float_t ptMin)
   return count;
 }
   
+//____________________________________________________________________
+void AliUEHistograms::FillKinematicsSnapshot(TObjArray* list, TArrayD& pt, TArrayF& eta, TArrayD& phi, TArrayS& charge)
+{
+  // copies pT, eta, phi and charge of the particles in <list> into contiguous arrays
+  // this calls the virtual getters once per particle instead of once per pair
+  
+  const Int_t n = list->GetEntriesFast();
+  pt.Set(n);
+  eta.Set(n);
+  phi.Set(n);
+  charge.Set(n);
+  
+  for (Int_t i=0; i<n; i++)
+  {
+    AliVParticle* particle = (AliVParticle*) list->UncheckedAt(i);
+    pt[i] = particle->Pt();
+    eta[i] = particle->Eta();
+    phi[i] = particle->Phi();
+    charge[i] = particle->Charge();
+  }
+}
+
+//____________________________________________________________________
+void AliUEHistograms::FillEfficiencySnapshot(THnF* efficiency, const TArrayF& eta, const TArrayD& pt, Double_t centrality, Float_t zVtx, TArrayF& weights)
+{
+  // looks up the efficiency correction factor for each particle (1 if <efficiency> is 0)
+  
+  const Int_t n = pt.GetSize();
+  weights.Set(n);
+  
+  if (!efficiency)
+  {
+    weights.Reset(1);
+    return;
+  }
+  
+  Int_t effVars[4];
+  effVars[2] = efficiency->GetAxis(2)->FindBin(centrality);
+  effVars[3] = efficiency->GetAxis(3)->FindBin(zVtx);
+  
+  for (Int_t i=0; i<n; i++)
+  {
+    effVars[0] = efficiency->GetAxis(0)->FindBin(eta[i]);
+    effVars[1] = efficiency->GetAxis(1)->FindBin(pt[i]);
+    weights[i] = efficiency->GetBinContent(effVars);
+  }
+}
+
+//____________________________________________________________________
+Bool_t AliUEHistograms::IsSameParticleOrEvent(AliVParticle* triggerParticle, AliVParticle* particle, Bool_t mixed)
+{
+  // check if both particles point to the same element (does not occur for mixed events, but if subsets are mixed within the same event)
+  
+  if (fCheckEventNumberInCorrelation)
+  {
+    AliBasicParticle* triggerParticleBasic = dynamic_cast<AliBasicParticle*>(triggerParticle);
+    AliBasicParticle* particleBasic        = dynamic_cast<AliBasicParticle*>(particle);
+    if(!triggerParticleBasic || !particleBasic)
+    {
+      AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
+      return kTRUE;
+    }
+
+    return triggerParticleBasic->IsInSameEvent(particleBasic);
+  }
+  
+  return (mixed && triggerParticle->IsEqual(particle));
+}
+
 //____________________________________________________________________
 void AliUEHistograms::Fill(Int_t eventType, Float_t zVtx, AliUEHist::CFStep step, AliVParticle* leading, TList* toward, TList* away, TList* min, TList* max)
 {
@@ -566,52 +639,75 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
     TH1::AddDirectory(oldStatus);
   }
 
-  // Eta() is extremely time consuming, therefore cache it for the inner loop here:
-  TObjArray* input = (mixed) ? mixed : particles;
-  TArrayF eta(input->GetEntriesFast());
-  for (Int_t i=0; i<input->GetEntriesFast(); i++)
-    eta[i] = ((AliVParticle*) input->UncheckedAt(i))->Eta();
-  
   // if particles is not set, just fill event statistics
   if (particles)
   {
-    Int_t jMax = particles->GetEntriesFast();
+    // the virtual getters (in particular Eta()) are time consuming, therefore a snapshot of the kinematics is 
+    // taken once per particle and the pair loops below run on contiguous arrays
+    const Int_t iMax = particles->GetEntriesFast();
+    Int_t jMax = iMax;
     if (mixed)
       jMax = mixed->GetEntriesFast();
     
+    TArrayD triggerPtArr, triggerPhiArr, associatedPtArr, associatedPhiArr;
+    TArrayF triggerEtaArr, triggerEffArr, associatedEtaArr, associatedEffArr;
+    TArrayS triggerChargeArr, associatedChargeArr;
+    
+    FillKinematicsSnapshot(particles, triggerPtArr, triggerEtaArr, triggerPhiArr, triggerChargeArr);
+    FillEfficiencySnapshot((applyEfficiency) ? fEfficiencyCorrectionTriggers : 0, triggerEtaArr, triggerPtArr, centrality, zVtx, triggerEffArr);
+    if (mixed)
+      FillKinematicsSnapshot(mixed, associatedPtArr, associatedEtaArr, associatedPhiArr, associatedChargeArr);
+    FillEfficiencySnapshot((applyEfficiency) ? fEfficiencyCorrectionAssociated : 0, (mixed) ? associatedEtaArr : triggerEtaArr, (mixed) ? associatedPtArr : triggerPtArr, centrality, zVtx, associatedEffArr);
+    
+    const Double_t* triggerPt  = triggerPtArr.GetArray();
+    const Float_t*  triggerEta = triggerEtaArr.GetArray();
+    const Double_t* triggerPhi = triggerPhiArr.GetArray();
+    const Short_t*  triggerCharge = triggerChargeArr.GetArray();
+    const Float_t*  triggerEff = triggerEffArr.GetArray();
+    
+    const Double_t* pt  = (mixed) ? associatedPtArr.GetArray()     : triggerPt;
+    const Float_t*  eta = (mixed) ? associatedEtaArr.GetArray()    : triggerEta;
+    const Double_t* phi = (mixed) ? associatedPhiArr.GetArray()    : triggerPhi;
+    const Short_t*  charge = (mixed) ? associatedChargeArr.GetArray() : triggerCharge;
+    const Float_t*  associatedEff = associatedEffArr.GetArray();
+    
+    // flags for particles identified as K, Lambda daughters
+    TArrayC triggerResonanceFlagArr(iMax);
+    TArrayC associatedResonanceFlagArr(jMax);
+    Char_t* triggerResonanceFlag = triggerResonanceFlagArr.GetArray();
+    Char_t* resonanceFlag = (mixed) ? associatedResonanceFlagArr.GetArray() : triggerResonanceFlag;
+    
     TH1* triggerWeighting = 0;
+    TArrayF triggerWeightingArr(iMax);
     if (fWeightPerEvent)
     {
       TAxis* axis = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->GetGrid(0)->GetGrid()->GetAxis(2);
       triggerWeighting = new TH1F("triggerWeighting", "", axis->GetNbins(), axis->GetXbins()->GetArray());
     
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+      for (Int_t i=0; i<iMax; i++)
       {
-	AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
-	
-	// some optimization
-	Float_t triggerEta = triggerParticle->Eta();
-
-	if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
+	if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta[i]) > fTriggerRestrictEta)
 	  continue;
 
 	if (fOnlyOneEtaSide != 0)
 	{
-	  if (fOnlyOneEtaSide * triggerEta < 0)
+	  if (fOnlyOneEtaSide * triggerEta[i] < 0)
 	    continue;
 	}
 	
 	if (fTriggerSelectCharge != 0)
-	  if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
+	  if (triggerCharge[i] * fTriggerSelectCharge < 0)
 	    continue;
 	
-	triggerWeighting->Fill(triggerParticle->Pt());
+	triggerWeighting->Fill(triggerPt[i]);
       }
+      
+      // weight per trigger particle
+      for (Int_t i=0; i<iMax; i++)
+	triggerWeightingArr[i] = triggerWeighting->GetBinContent(triggerWeighting->GetXaxis()->FindBin(triggerPt[i]));
     }
     
     // identify K, Lambda candidates and flag those particles
-    // a TObject bit is used for this
-    const UInt_t kResonanceDaughterFlag = 1 << 14;
     if (fRejectResonanceDaughters > 0)
     {
       Double_t resonanceMass = -1;
@@ -627,13 +723,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	default: AliFatal(Form("Invalid setting %d", fRejectResonanceDaughters));
       }
 
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
-	particles->UncheckedAt(i)->ResetBit(kResonanceDaughterFlag);
-      if (mixed)
-	for (Int_t i=0; i<jMax; i++)
-	  mixed->UncheckedAt(i)->ResetBit(kResonanceDaughterFlag);
-      
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+      for (Int_t i=0; i<iMax; i++)
       {
 	AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
 	
@@ -642,42 +732,24 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  if (!mixed && i == j)
 	    continue;
 	
-	  AliVParticle* particle = 0;
-	  if (!mixed)
-	    particle = (AliVParticle*) particles->UncheckedAt(j);
-	  else
-	    particle = (AliVParticle*) mixed->UncheckedAt(j);
-	  
+	  if (triggerCharge[i] * charge[j] > 0)
+	    continue;
+      
 	  // check if both particles point to the same element (does not occur for mixed events, but if subsets are mixed within the same event)
-	  if (fCheckEventNumberInCorrelation)
-	  {
-	    AliBasicParticle* triggerParticleBasic = dynamic_cast<AliBasicParticle*>(triggerParticle);
-	    AliBasicParticle* particleBasic        = dynamic_cast<AliBasicParticle*>(particle);
-	    if(!triggerParticleBasic || !particleBasic)
-	    {
-	      AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
+	  if (fCheckEventNumberInCorrelation || mixed)
+	    if (IsSameParticleOrEvent(triggerParticle, (AliVParticle*) ((mixed) ? mixed : particles)->UncheckedAt(j), mixed != 0))
 	      continue;
-	    }
-	
-	    if(triggerParticleBasic->IsInSameEvent(particleBasic))
-	      continue;
-	  }
-	  else if (mixed && triggerParticle->IsEqual(particle))
-	    continue;
 	  
-	  if (triggerParticle->Charge() * particle->Charge() > 0)
-	    continue;
-      
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerParticle->Eta(), triggerParticle->Phi(), particle->Pt(), particle->Eta(), particle->Phi(), massDaughter1, massDaughter2);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt[i], triggerEta[i], triggerPhi[i], pt[j], eta[j], phi[j], massDaughter1, massDaughter2);
 	      
 	  if (TMath::Abs(mass - resonanceMass*resonanceMass) < interval*5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerParticle->Eta(), triggerParticle->Phi(), particle->Pt(), particle->Eta(), particle->Phi(), massDaughter1, massDaughter2);
+	    mass = GetInvMassSquared(triggerPt[i], triggerEta[i], triggerPhi[i], pt[j], eta[j], phi[j], massDaughter1, massDaughter2);
 
 	    if (mass > (resonanceMass-interval)*(resonanceMass-interval) && mass < (resonanceMass+interval)*(resonanceMass+interval))
 	    {
-	      triggerParticle->SetBit(kResonanceDaughterFlag);
-	      particle->SetBit(kResonanceDaughterFlag);
+	      triggerResonanceFlag[i] = 1;
+	      resonanceFlag[j] = 1;
 	      
 // 	      Printf("Flagged %d %d %f", i, j, TMath::Sqrt(mass));
 	    }
@@ -686,28 +758,25 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
     }
     
-    for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+    for (Int_t i=0; i<iMax; i++)
     {
       AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
       
-      // some optimization
-      Float_t triggerEta = triggerParticle->Eta();
-      
-      if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
+      if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta[i]) > fTriggerRestrictEta)
 	continue;
 
       if (fOnlyOneEtaSide != 0)
       {
-	if (fOnlyOneEtaSide * triggerEta < 0)
+	if (fOnlyOneEtaSide * triggerEta[i] < 0)
 	  continue;
       }
       
       if (fTriggerSelectCharge != 0)
-	if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
+	if (triggerCharge[i] * fTriggerSelectCharge < 0)
 	  continue;
 	
       if (fRejectResonanceDaughters > 0)
-	if (triggerParticle->TestBit(kResonanceDaughterFlag))
+	if (triggerResonanceFlag[i])
 	{
 // 	  Printf("Skipped i=%d", i);
 	  continue;
@@ -718,68 +787,53 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
         if (!mixed && i == j)
           continue;
       
-        AliVParticle* particle = 0;
-        if (!mixed)
-          particle = (AliVParticle*) particles->UncheckedAt(j);
-        else
-          particle = (AliVParticle*) mixed->UncheckedAt(j);
-        
         // check if both particles point to the same element (does not occur for mixed events, but if subsets are mixed within the same event)
-        if (fCheckEventNumberInCorrelation)
-        {
-          AliBasicParticle* triggerParticleBasic = dynamic_cast<AliBasicParticle*>(triggerParticle);
-          AliBasicParticle* particleBasic        = dynamic_cast<AliBasicParticle*>(particle);
-          if(!triggerParticleBasic || !particleBasic)
-            AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
-      
-          if(triggerParticleBasic->IsInSameEvent(particleBasic))
+        if (fCheckEventNumberInCorrelation || mixed)
+          if (IsSameParticleOrEvent(triggerParticle, (AliVParticle*) ((mixed) ? mixed : particles)->UncheckedAt(j), mixed != 0))
             continue;
-        }
-        else if (mixed && triggerParticle->IsEqual(particle))
-          continue;
         
         if (fPtOrder)
-	  if (particle->Pt() >= triggerParticle->Pt())
+	  if (pt[j] >= triggerPt[i])
 	    continue;
 	
 	if (fAssociatedSelectCharge != 0)
-	  if (particle->Charge() * fAssociatedSelectCharge < 0)
+	  if (charge[j] * fAssociatedSelectCharge < 0)
 	    continue;
 
         if (fSelectCharge > 0)
         {
           // skip like sign
-          if (fSelectCharge == 1 && particle->Charge() * triggerParticle->Charge() > 0)
+          if (fSelectCharge == 1 && charge[j] * triggerCharge[i] > 0)
             continue;
             
           // skip unlike sign
-          if (fSelectCharge == 2 && particle->Charge() * triggerParticle->Charge() < 0)
+          if (fSelectCharge == 2 && charge[j] * triggerCharge[i] < 0)
             continue;
         }
         
 	if (fEtaOrdering)
 	{
-	  if (triggerEta < 0 && eta[j] < triggerEta)
+	  if (triggerEta[i] < 0 && eta[j] < triggerEta[i])
 	    continue;
-	  if (triggerEta > 0 && eta[j] > triggerEta)
+	  if (triggerEta[i] > 0 && eta[j] > triggerEta[i])
 	    continue;
 	}
 
 	if (fRejectResonanceDaughters > 0)
-	  if (particle->TestBit(kResonanceDaughterFlag))
+	  if (resonanceFlag[j])
 	  {
 // 	    Printf("Skipped j=%d", j);
 	    continue;
 	  }
 
 	// conversions
-	if (fCutConversionsV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutConversionsV > 0 && charge[j] * triggerCharge[i] < 0)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt[i], triggerEta[i], triggerPhi[i], pt[j], eta[j], phi[j], 0.510e-3, 0.510e-3);
 	  
 	  if (mass < fCutConversionsV * 5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
+	    mass = GetInvMassSquared(triggerPt[i], triggerEta[i], triggerPhi[i], pt[j], eta[j], phi[j], 0.510e-3, 0.510e-3);
 	    
 	    fControlConvResoncances->Fill(0.0, mass);
 
@@ -789,15 +843,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 	
 	// K0s
-	if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutResonancesV > 0 && charge[j] * triggerCharge[i] < 0)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt[i], triggerEta[i], triggerPhi[i], pt[j], eta[j], phi[j], 0.1396, 0.1396);
 	  
 	  const Float_t kK0smass = 0.4976;
 	  
 	  if (TMath::Abs(mass - kK0smass*kK0smass) < fCutResonancesV * 5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	    mass = GetInvMassSquared(triggerPt[i], triggerEta[i], triggerPhi[i], pt[j], eta[j], phi[j], 0.1396, 0.1396);
 	    
 	    fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
 
@@ -807,16 +861,16 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 	
 	// Lambda
-	if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutResonancesV > 0 && charge[j] * triggerCharge[i] < 0)
 	{
-	  Float_t mass1 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-	  Float_t mass2 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
+	  Float_t mass1 = GetInvMassSquaredCheap(triggerPt[i], triggerEta[i], triggerPhi[i], pt[j], eta[j], phi[j], 0.1396, 0.9383);
+	  Float_t mass2 = GetInvMassSquaredCheap(triggerPt[i], triggerEta[i], triggerPhi[i], pt[j], eta[j], phi[j], 0.9383, 0.1396);
 	  
 	  const Float_t kLambdaMass = 1.115;
 
 	  if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
 	  {
-	    mass1 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
+	    mass1 = GetInvMassSquared(triggerPt[i], triggerEta[i], triggerPhi[i], pt[j], eta[j], phi[j], 0.1396, 0.9383);
 
 	    fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
 	    
@@ -825,7 +879,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  }
 	  if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
 	  {
-	    mass2 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
+	    mass2 = GetInvMassSquared(triggerPt[i], triggerEta[i], triggerPhi[i], pt[j], eta[j], phi[j], 0.9383, 0.1396);
 
 	    fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
 
@@ -839,15 +893,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  // the variables & cuthave been developed by the HBT group 
 	  // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
 
-	  Float_t phi1 = triggerParticle->Phi();
-	  Float_t pt1 = triggerParticle->Pt();
-	  Float_t charge1 = triggerParticle->Charge();
+	  Float_t phi1 = triggerPhi[i];
+	  Float_t pt1 = triggerPt[i];
+	  Float_t charge1 = triggerCharge[i];
 	    
-	  Float_t phi2 = particle->Phi();
-	  Float_t pt2 = particle->Pt();
-	  Float_t charge2 = particle->Charge();
+	  Float_t phi2 = phi[j];
+	  Float_t pt2 = pt[j];
+	  Float_t charge2 = charge[j];
 	      
-	  Float_t deta = triggerEta - eta[j];
+	  Float_t deta = triggerEta[i] - eta[j];
 	      
 	  // optimization
 	  if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
@@ -889,11 +943,11 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
         
         Double_t vars[6];
-        vars[0] = triggerEta - eta[j];
-        vars[1] = particle->Pt();
-        vars[2] = triggerParticle->Pt();
+        vars[0] = triggerEta[i] - eta[j];
+        vars[1] = pt[j];
+        vars[2] = triggerPt[i];
         vars[3] = centrality;
-        vars[4] = triggerParticle->Phi() - particle->Phi();
+        vars[4] = triggerPhi[i] - phi[j];
         if (vars[4] > 1.5 * TMath::Pi()) 
           vars[4] -= TMath::TwoPi();
         if (vars[4] < -0.5 * TMath::Pi())
@@ -901,88 +955,58 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	vars[5] = zVtx;
 	
 	if (fillpT)
-	  weight = particle->Pt();
+	  weight = pt[j];
 	
 	Double_t useWeight = weight;
 	if (applyEfficiency)
 	{
 	  if (fEfficiencyCorrectionAssociated)
-	  {
-	    Int_t effVars[4];
-	    // associated particle
-	    effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(eta[j]);
-	    effVars[1] = fEfficiencyCorrectionAssociated->GetAxis(1)->FindBin(vars[1]); //pt
-	    effVars[2] = fEfficiencyCorrectionAssociated->GetAxis(2)->FindBin(vars[3]); //centrality
-	    effVars[3] = fEfficiencyCorrectionAssociated->GetAxis(3)->FindBin(vars[5]); //zVtx
-	    
-	    // 	  Printf("%d %d %d %d %f", effVars[0], effVars[1], effVars[2], effVars[3], fEfficiencyCorrectionAssociated->GetBinContent(effVars));
-	  
-	    useWeight *= fEfficiencyCorrectionAssociated->GetBinContent(effVars);
-	  }
+	    useWeight *= associatedEff[j];
 	  if (fEfficiencyCorrectionTriggers)
-	  {
-	    Int_t effVars[4];
-
-	    effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
-	    effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[2]); //pt
-	    effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[3]); //centrality
-	    effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[5]); //zVtx
-	    useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
-	  }
+	    useWeight *= triggerEff[i];
 	}
 
 	if (fWeightPerEvent)
 	{
-	  Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(vars[2]);
-// 	  Printf("Using weight %f", triggerWeighting->GetBinContent(weightBin));
-	  useWeight /= triggerWeighting->GetBinContent(weightBin);
+// 	  Printf("Using weight %f", triggerWeightingArr[i]);
+	  useWeight /= triggerWeightingArr[i];
 	}
     
         // fill all in toward region and do not use the other regions
 	fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->Fill(vars, step, useWeight);
 
-// 	Printf("%.2f %.2f --> %.2f", triggerEta, eta[j], vars[0]);
+// 	Printf("%.2f %.2f --> %.2f", triggerEta[i], eta[j], vars[0]);
       }
  
       if (firstTime)
       {
         // once per trigger particle
         Double_t vars[3];
-        vars[0] = triggerParticle->Pt();
+        vars[0] = triggerPt[i];
         vars[1] = centrality;
 	vars[2] = zVtx;
 
 	Double_t useWeight = 1;
 	if (fEfficiencyCorrectionTriggers && applyEfficiency)
-	{
-	  Int_t effVars[4];
-	  
-	  // trigger particle
-	  effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
-	  effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[0]); //pt
-	  effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[1]); //centrality
-	  effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[2]); //zVtx
-	  useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
-	}
+	  useWeight *= triggerEff[i];
 
-	if (TMath::Abs(triggerEta) < 0.8 && triggerParticle->Pt() > 0)
-	  fInvYield2->Fill(centrality, triggerParticle->Pt(), useWeight / triggerParticle->Pt());
+	if (TMath::Abs(triggerEta[i]) < 0.8 && triggerPt[i] > 0)
+	  fInvYield2->Fill(centrality, triggerPt[i], useWeight / triggerPt[i]);
 
 	if (fWeightPerEvent)
 	{
 	  // leads effectively to a filling of one entry per filled trigger particle pT bin
-	  Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(vars[0]);
-// 	  Printf("Using weight %f", triggerWeighting->GetBinContent(weightBin));
-	  useWeight /= triggerWeighting->GetBinContent(weightBin);
+// 	  Printf("Using weight %f", triggerWeightingArr[i]);
+	  useWeight /= triggerWeightingArr[i];
 	}
 	
         fNumberDensityPhi->GetEventHist()->Fill(vars, step, useWeight);
 
 	// QA
-        fCorrelationpT->Fill(centrality, triggerParticle->Pt());
-        fCorrelationEta->Fill(centrality, triggerEta);
-        fCorrelationPhi->Fill(centrality, triggerParticle->Phi());
-	fYields->Fill(centrality, triggerParticle->Pt(), triggerEta);
+        fCorrelationpT->Fill(centrality, triggerPt[i]);
+        fCorrelationEta->Fill(centrality, triggerEta[i]);
+        fCorrelationPhi->Fill(centrality, triggerPhi[i]);
+	fYields->Fill(centrality, triggerPt[i], triggerEta[i]);
 	
 /*        if (dynamic_cast<AliAODTrack*>(triggerParticle))
           fITSClusterMap->Fill(((AliAODTrack*) triggerParticle)->GetITSClusterMap(), centrality, triggerParticle->Pt());*/
@@ -21,6 +21,10 @@ class TObjArray;
 class TH1F;
 class TH2F;
 class TH3F;
+class TArrayC;
+class TArrayD;
+class TArrayF;
+class TArrayS;
 
 class AliUEHistograms : public TNamed
 {
@@ -110,6 +114,9 @@ protected:
   void FillRegion(AliUEHist::Region region, Float_t zVtx, AliUEHist::CFStep step, AliVParticle* leading, TList* list, Int_t multiplicity);
   Int_t CountParticles(TList* list, Float_t ptMin);
   void DeleteContainers();
+  void FillKinematicsSnapshot(TObjArray* list, TArrayD& pt, TArrayF& eta, TArrayD& phi, TArrayS& charge);
+  void FillEfficiencySnapshot(THnF* efficiency, const TArrayF& eta, const TArrayD& pt, Double_t centrality, Float_t zVtx, TArrayF& weights);
+  Bool_t IsSameParticleOrEvent(AliVParticle* triggerParticle, AliVParticle* particle, Bool_t mixed);
   inline Float_t GetInvMassSquared(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetInvMassSquaredCheap(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign);
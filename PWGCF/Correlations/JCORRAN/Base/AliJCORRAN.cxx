@@ -260,6 +260,7 @@ void AliJCORRAN::UserCreateOutputObjects(){
   // EventPool for Mixing
   fphotonPool  = new AliJEventPool( fcard, fhistos, fcorrelations, kJPhoton);  // for pi0 mass
   fassocPool   = new AliJEventPool( fcard, fhistos, fcorrelations, fjassoc);
+  fassocPool->SetUseFlatPool( fcard->UseFlatEventPool() );
   
   fphotonList = new TClonesArray(kParticleProtoType[kJPhoton],1500);
   //     TClonesArray *cellList = new TClonesArray("AliJCaloCell",1500);
@@ -88,6 +88,8 @@ class AliJCard : public AliJBaseCard {
 
         //-----  m i x i n g ----
         int    GetEventPoolDepth(int cBin){ return (int) Get("EventPoolDepth",cBin);}
+        // optional key, the pooled tracks are kept in AliJFlatEvent columns (AliJEventPool::SetUseFlatPool)
+        bool   UseFlatEventPool(){ int i = GetTVectorIndex("UseFlatEventPool", 2); return i > -1 && Get("UseFlatEventPool") > 0; }
         bool   SimilarVertZ(float Z1, float Z2);
         bool   SimilarMultiplicity(float mult1, float mult2);
         bool   SimilarCentrality(float c1, float c2, int cbin);
@@ -16,9 +16,24 @@
 // Interface that all correlation analysis must fulfill
 
 #include "AliJCorrelationInterface.h"
+#include "AliJFlatEvent.h"
 
 
-AliJCorrelationInterface::AliJCorrelationInterface()
+AliJCorrelationInterface::AliJCorrelationInterface() :
+  fFlatTrack()
 {
   // default constructor
-}
\ No newline at end of file
+}
+
+void AliJCorrelationInterface::FillMixedHisto(corrFillType cFTyp, int cBin, int zBin, AliJBaseTrack *ftk1, const AliJFlatEvent *assocEvent, bool leadingParticle)
+{
+  // Fill the mixed event histograms of the trigger ftk1 with all tracks of assocEvent.
+  // Generic version rebuilding each associated track for FillHisto,
+  // correlation classes can override it with a loop over the columns.
+  const float *pta = assocEvent->GetPt();
+  for(int jj=0; jj<assocEvent->GetEntries(); jj++){
+    if(leadingParticle && ftk1->Pt() < pta[jj]) continue; // In leading particle correlations, accept only those associated particles whose pT is lower than that of the trigger
+    assocEvent->FillTrack(jj, &fFlatTrack);
+    FillHisto(cFTyp, kMixed, cBin, zBin, ftk1, &fFlatTrack);
+  }
+}
@@ -17,6 +17,8 @@
 
 using namespace std;
 
+class AliJFlatEvent;
+
 class AliJCorrelationInterface {
   
 public:
@@ -25,6 +27,11 @@ public:
   virtual ~AliJCorrelationInterface(){;} //destructor
   
   virtual void FillHisto(corrFillType cFTyp, fillType fTyp, int cBin, int zBin, AliJBaseTrack *ftk1, AliJBaseTrack *ftk2) = 0; // virtual histogram filler method needed in AliJEventPool.cxx
+  virtual void FillMixedHisto(corrFillType cFTyp, int cBin, int zBin, AliJBaseTrack *ftk1, const AliJFlatEvent *assocEvent, bool leadingParticle); // trigger against all tracks of a flat pooled event, by default track by track with FillHisto
+
+private:
+
+  AliJBaseTrack fFlatTrack; //! track rebuilt from the flat pool by the default FillMixedHisto
 
 };
 
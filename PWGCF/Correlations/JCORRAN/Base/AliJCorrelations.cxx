@@ -15,11 +15,14 @@
 
 // Implementation for correlation analysis
 
+#include <TVector2.h>
+
 #include "AliJCorrelations.h"
 #include "AliJDataManager.h"
 
 #include "AliJHistos.h"
 #include "AliJBaseTrack.h"
+#include "AliJFlatEvent.h"
 #include "AliJCard.h"
 #include "AliJHistos.h"
 #include "AliJRunTable.h"
@@ -323,11 +326,6 @@ void AliJCorrelations::FillAzimuthHistos(fillType fTyp, int CentBin, int ZBin, A
   //if( rGapBin != fRGapBinAway ) cout<<"dR vs fRGapBinAway = "<<rGapBin<<"\t"<<fRGapBinAway<<endl;
   //----------------------------------------------------------------
   
-  //acceptance correction  triangle  or mixed fevent
-  //  fGeometricAcceptanceCorrection = 1;
-  fGeometricAcceptanceCorrection = fAcceptanceCorrection->GetAcceptanceCorrectionTraditional(fsamplingMethod, fDeltaEta, fDeltaPhiPiPi, fCentralityBin, fpttBin);
-  fGeometricAcceptanceCorrection3D = fAcceptanceCorrection->GetAcceptanceCorrection3DNearSide(fsamplingMethod, fDeltaEta, fDeltaPhiPiPi, fCentralityBin, fpttBin);
-  
   if(fpttBin<0 || fptaBin<0 || fEtaGapBin<0 ){
     cout<<"Error in FillAzimuthHistos: some pT or eta out of bin. pttBin="<<fpttBin<<" pTaBin="<<fptaBin <<" etaGapBin="<< fEtaGapBin << endl;
     ftk1->Print();
@@ -338,6 +336,91 @@ void AliJCorrelations::FillAzimuthHistos(fillType fTyp, int CentBin, int ZBin, A
   
   if(fDeltaPhi==0) cout <<" fdphi=0; fptt="<<  fptt<<"   fpta="<<fpta<<"  TID="<<ftk1->GetID()<<"  AID="<<ftk2->GetID() <<" tphi="<< fPhiTrigger <<" aphi="<< fPhiAssoc << endl;
   
+  FillAzimuthPairHistos(fTyp, ZBin);
+  
+}
+
+//=============================================================================================
+void AliJCorrelations::FillMixedHisto(corrFillType cFTyp, int cBin, int zBin, AliJBaseTrack *ftk1, const AliJFlatEvent *assocEvent, bool leadingParticle)
+//=============================================================================================
+{
+  // Fill the mixed event histograms of the trigger ftk1 with all tracks of a flat pooled event.
+  // Same as FillAzimuthHistos for each pair, the trigger quantities are computed only once.
+  if( cFTyp != kAzimuthFill ) return;
+  
+  const int nAssoc = assocEvent->GetEntries();
+  const float *pta = assocEvent->GetPt();
+  const float *etaa = assocEvent->GetEta();
+  const float *phia = assocEvent->GetPhi();
+  const float *effa = assocEvent->GetTrackEff();
+  const char *chargea = assocEvent->GetCharge();
+  const short *ptaBina = assocEvent->GetAssocBin();
+  
+  const int chargeTrigger = ftk1->GetCharge();
+  const double effTrigger = ftk1->GetTrackEff();
+  const double pxTrigger = ftk1->Px(), pyTrigger = ftk1->Py(), pzTrigger = ftk1->Pz();
+  const double p2Trigger = pow(ftk1->P(),2);
+  fptt              = ftk1->Pt();
+  fIsIsolatedTrigger = ftk1->GetIsIsolated()>0  ? true : false;
+  fpttBin           = ftk1->GetTriggBin();
+  fPhiTrigger       = ftk1->Phi();
+  fEtaTrigger       = ftk1->Eta();
+  fCentralityBin    = cBin;
+  
+  for(int jj=0; jj<nAssoc; jj++){
+    if(leadingParticle && fptt < pta[jj]) continue; // In leading particle correlations, accept only those associated particles whose pT is lower than that of the trigger
+    
+    fIsLikeSign = (chargeTrigger > 0 && chargea[jj] > 0) || (chargeTrigger < 0 && chargea[jj] < 0);
+    
+    fpta = pta[jj];
+    fTrackPairEfficiency = 1./( effTrigger * effa[jj] );
+    fptaBin       = ptaBina[jj];
+    fPhiAssoc     = phia[jj];
+    fEtaAssoc     = etaa[jj];
+    fDeltaPhi     = DeltaPhi(fPhiTrigger, fPhiAssoc);  //radians
+    fDeltaPhiPiPi = atan2(sin(fPhiTrigger-fPhiAssoc), cos(fPhiTrigger-fPhiAssoc));
+    fDeltaEta     = fEtaTrigger - fEtaAssoc;
+    
+    double pxAssoc = fpta*cos(fPhiAssoc), pyAssoc = fpta*sin(fPhiAssoc), pzAssoc = fpta*sinh(fEtaAssoc);
+    double pDot = pxTrigger*pxAssoc + pyTrigger*pyAssoc + pzTrigger*pzAssoc;
+    double dPhiR = TVector2::Phi_mpi_pi(fPhiTrigger-fPhiAssoc);
+    
+    fNearSide     = cos(fPhiTrigger-fPhiAssoc) > 0 ? true : false;  // Traditional near side definition using deltaPhi
+    fNearSide3D   = pDot > 0 ? true : false; // Near side definition using half ball around the trigger
+    
+    fEtaGapBin = fcard->GetBin( kEtaGapType, fabs(fDeltaEta));
+    fPhiGapBinNear = fcard->GetBin( kEtaGapType, fabs(fDeltaPhiPiPi) );
+    fPhiGapBinAway = fcard->GetBin( kEtaGapType, fabs(fDeltaPhi-kJPi) ); //here the angle must be 0-2pi and not (-pi,pi)
+    fRGapBinNear   = fcard->GetBin( kRGapType, sqrt(fDeltaEta*fDeltaEta+dPhiR*dPhiR) );
+    fRGapBinAway   = fcard->GetBin( kRGapType, sqrt(pow(fDeltaPhi-kJPi,2)+fDeltaEta*fDeltaEta) );
+    
+    fXlong = pDot/p2Trigger;
+    fXlongBin = fcard->GetBin(kXeType, TMath::Abs(fXlong));
+    
+    if(fpttBin<0 || fptaBin<0 || fEtaGapBin<0 ){
+      cout<<"Error in FillMixedHisto: some pT or eta out of bin. pttBin="<<fpttBin<<" pTaBin="<<fptaBin <<" etaGapBin="<< fEtaGapBin << endl;
+      ftk1->Print();
+      cout<<"assoc pt="<<fpta<<" eta="<<fEtaAssoc<<" phi="<<fPhiAssoc<<endl;
+      exit(-1);
+    }
+    
+    if(fDeltaPhi==0) cout <<" fdphi=0; fptt="<<  fptt<<"   fpta="<<fpta<<"  TID="<<ftk1->GetID() <<" tphi="<< fPhiTrigger <<" aphi="<< fPhiAssoc << endl;
+    
+    FillAzimuthPairHistos(kMixed, zBin);
+  }
+}
+
+//=============================================================================================
+void AliJCorrelations::FillAzimuthPairHistos(fillType fTyp, int ZBin)
+//=============================================================================================
+{
+  // Fill the histograms of the pair whose variables are set
+  
+  //acceptance correction  triangle  or mixed fevent
+  //  fGeometricAcceptanceCorrection = 1;
+  fGeometricAcceptanceCorrection = fAcceptanceCorrection->GetAcceptanceCorrectionTraditional(fsamplingMethod, fDeltaEta, fDeltaPhiPiPi, fCentralityBin, fpttBin);
+  fGeometricAcceptanceCorrection3D = fAcceptanceCorrection->GetAcceptanceCorrection3DNearSide(fsamplingMethod, fDeltaEta, fDeltaPhiPiPi, fCentralityBin, fpttBin);
+  
   // ===================================================================
   // =====================  Fill Histograms  ===========================
   // ===================================================================
@@ -44,6 +44,7 @@ public:
   
   void FillHisto(corrFillType cFTyp, fillType fTyp,    int cBin, int zBin, AliJBaseTrack *ftk1, AliJBaseTrack *ftk2);
   void FillAzimuthHistos (fillType fTyp,    int cBin, int zBin, AliJBaseTrack *ftk1, AliJBaseTrack *ftk2);
+  void FillMixedHisto(corrFillType cFTyp, int cBin, int zBin, AliJBaseTrack *ftk1, const AliJFlatEvent *assocEvent, bool leadingParticle);
   
   double GetGeoAccCorrFlat(double deltaEta);
   double GetGeoAccCorrIncl(double deltaEta, int assocBin, int assocType);
@@ -110,6 +111,7 @@ protected:
   
 private:
   
+  void FillAzimuthPairHistos(fillType fTyp, int zBin);
   void FillPairPtAndCosThetaStarHistograms(fillType fTyp, AliJBaseTrack *ftk1, AliJBaseTrack *ftk2);
   void FillXeHistograms(fillType fTyp);
   void FillDeltaEtaHistograms(fillType fTyp, int zBin);
@@ -29,7 +29,8 @@ AliJEventPool::AliJEventPool(AliJCard *cardin, AliJHistogramInterface *histosin,
   //ftk1(NULL),
   //ftk2(NULL),
   fthisPoolType(particle),
-  fpoolList(NULL)
+  fpoolList(NULL),
+  fUseFlatPool(false)
 {       
   // constructor
   
@@ -76,7 +77,8 @@ AliJEventPool::AliJEventPool(const AliJEventPool& obj) :
   //ftk1(obj.ftk1),
   //ftk2(obj.ftk2),
   fthisPoolType(obj.fthisPoolType),
-  fpoolList(obj.fpoolList)
+  fpoolList(obj.fpoolList),
+  fUseFlatPool(obj.fUseFlatPool)
 {
   // copy constructor
   JUNUSED(obj);
@@ -89,6 +91,31 @@ AliJEventPool& AliJEventPool::operator=(const AliJEventPool& obj){
 }
   
 
+//______________________________________________________________________________
+void AliJEventPool::SetUseFlatPool(bool useFlat){
+  // switch between the TClonesArray and the flat storage of the pooled events
+  if( useFlat == fUseFlatPool ) return;
+  if( useFlat && ( fthisPoolType == kJPhoton || fthisPoolType == kJDecayphoton || fthisPoolType == kJPizero || fthisPoolType == kJEta ) ){
+    cout<<"WARNING: no flat event pool for <"<<kParticleTypeStrName[fthisPoolType]<<">, keep the "<<kParticleProtoType[fthisPoolType]<<" pool"<<endl;
+    return;
+  }
+  for(int ic=0;ic<fcard->GetNoOfBins(kCentrType);ic++){
+    for(int ie=0;ie<fcard->GetEventPoolDepth(ic); ie++){
+      if( useFlat ){
+        delete fLists[ic][ie];
+        fLists[ic][ie] = NULL;
+      } else {
+        fLists[ic][ie] = new TClonesArray(kParticleProtoType[fthisPoolType],1500);
+      }
+    }
+    if( useFlat ) fFlatLists[ic].resize( fcard->GetEventPoolDepth(ic) );
+    else vector<AliJFlatEvent>().swap( fFlatLists[ic] );
+    flastAccepted[ic] = -1; // pooled events are not kept
+    fwhereToStore[ic] = -1;
+  }
+  fUseFlatPool = useFlat;
+}
+
 //______________________________________________________________________________
 void AliJEventPool::Mix( TClonesArray *triggList, 
         corrFillType cFTyp, 
@@ -105,8 +132,14 @@ void AliJEventPool::Mix( TClonesArray *triggList,
 
 
     for(int backCounter=0; backCounter <= flastAccepted[cBin]; backCounter++){
-        fpoolList = fLists [cBin] [backCounter];
-        noAssoc = fpoolList->GetEntries();
+        const AliJFlatEvent *flatEvent = NULL;
+        if( fUseFlatPool ){
+            flatEvent = &fFlatLists [cBin] [backCounter];
+            noAssoc = flatEvent->GetEntries();
+        } else {
+            fpoolList = fLists [cBin] [backCounter];
+            noAssoc = fpoolList->GetEntries();
+        }
 
         if(noAssoc<=0) continue;
 
@@ -120,6 +153,12 @@ void AliJEventPool::Mix( TClonesArray *triggList,
                 fevent[cBin][backCounter] != iev )
         {
             fnoMixCut[cBin]++;
+            if( fUseFlatPool ){
+                for(int ii=0;ii<noTrigg;ii++){
+                    fcorrelations->FillMixedHisto(cFTyp, cBin, zBin, (AliJBaseTrack*)triggList->At(ii), flatEvent, leadingParticle);
+                }
+                continue;
+            }
             //=================================================
             // try to use only one track from each fevent
             //=================================================
@@ -153,6 +192,13 @@ void AliJEventPool::AcceptList(TClonesArray *inList, float cent, float Z, float
     fcentrality[cBin][fwhereToStore[cBin]] = cent;
     fmult      [cBin][fwhereToStore[cBin]] = inMult;
 
+    if( fUseFlatPool ){
+        AliJFlatEvent &flatEvent = fFlatLists[cBin][fwhereToStore[cBin]];
+        flatEvent.Clear();
+        for(int i=0;i<inList->GetEntriesFast();i++) flatEvent.Add( (AliJBaseTrack*)inList->At(i) );
+        return;
+    }
+
     fLists[cBin][fwhereToStore[cBin]]->Clear();
     for(int i=0;i<inList->GetEntriesFast();i++){
 				if( fthisPoolType == kJPhoton || fthisPoolType == kJDecayphoton ){
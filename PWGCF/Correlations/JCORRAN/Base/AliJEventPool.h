@@ -10,10 +10,12 @@
 #include <fstream>
 #include <stdlib.h>
 #include <stdio.h>
+#include <vector>
 
 using namespace std;
 
 #include <AliJConst.h>
+#include "AliJFlatEvent.h"
 
 class TClonesArray;
 class AliJBaseTrack;
@@ -45,6 +47,12 @@ class AliJEventPool {
 
         void AcceptList(TClonesArray *inList, float cent, float Z, float inMult, int iev);
 
+        // Store the pooled tracks as flat columns (AliJFlatEvent) instead of track copies and
+        // mix each trigger with a whole pooled event (AliJCorrelationInterface::FillMixedHisto).
+        // Kinematics are kept in single precision. Only for track pools, call before the first event.
+        void SetUseFlatPool(bool useFlat);
+        bool GetUseFlatPool() const { return fUseFlatPool; }
+
         void Mysample(TH1D *fromh, TH1D *toh );
         void PrintOut(){for(int i=0;i<kMaxNoCentrBin;i++)
             cout<<"c: "<<i<<" mixed "<<fnoMix[i]<<" accepted "<<fnoMixCut[i]<<" "<<(fnoMix[i]>0?fnoMixCut[i]*1.0/fnoMix[i]:0)<< endl;}
@@ -71,6 +79,9 @@ class AliJEventPool {
 
         TClonesArray  *fpoolList;  // pool list
 
+        bool fUseFlatPool; // pool stored in fFlatLists instead of fLists
+        vector<AliJFlatEvent> fFlatLists[kMaxNoCentrBin]; // flat mix lists, event pool depth per centrality bin
+
         //int   trials[MAXNOEVENT];
 
 };
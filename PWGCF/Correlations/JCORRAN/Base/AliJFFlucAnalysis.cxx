@@ -68,7 +68,15 @@ AliJFFlucAnalysis::AliJFFlucAnalysis()
 	fh_cn_2c(),
 	fh_cn_cn_2c(),
 	fh_cn_2c_eta10(),
-	fh_cn_cn_2c_eta10()
+	fh_cn_cn_2c_eta10(),
+	fTrkPt(),
+	fTrkEta(),
+	fTrkPhi(),
+	fTrkEffCorr(),
+	fTrkPhiModule(),
+	fTrkWeight(),
+	fTrkCos(),
+	fTrkSin()
 {
 	const int NCent = 7;
 	static Double_t CentBin[NCent+1] = {0, 5, 10, 20, 30, 40, 50, 60};
@@ -118,7 +126,15 @@ AliJFFlucAnalysis::AliJFFlucAnalysis(const char *name)
 	fh_cn_2c(),
 	fh_cn_cn_2c(),
 	fh_cn_2c_eta10(),
-	fh_cn_cn_2c_eta10()
+	fh_cn_cn_2c_eta10(),
+	fTrkPt(),
+	fTrkEta(),
+	fTrkPhi(),
+	fTrkEffCorr(),
+	fTrkPhiModule(),
+	fTrkWeight(),
+	fTrkCos(),
+	fTrkSin()
 {
 	cout << "analysis task created " << endl;
 	const int NCent = 7;
@@ -186,7 +202,15 @@ AliJFFlucAnalysis::AliJFFlucAnalysis(const AliJFFlucAnalysis& a):
 	fh_cn_2c(a.fh_cn_2c),
 	fh_cn_cn_2c(a.fh_cn_cn_2c),
 	fh_cn_2c_eta10(a.fh_cn_2c_eta10),
-	fh_cn_cn_2c_eta10(a.fh_cn_cn_2c_eta10)
+	fh_cn_cn_2c_eta10(a.fh_cn_cn_2c_eta10),
+	fTrkPt(),
+	fTrkEta(),
+	fTrkPhi(),
+	fTrkEffCorr(),
+	fTrkPhiModule(),
+	fTrkWeight(),
+	fTrkCos(),
+	fTrkSin()
 {
 	//copy constructor
 	//	DefineOutput(1, TList::Class() );
@@ -401,6 +425,8 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	DEBUG(3, "filled cent into histo" );
 	fh_ImpactParameter->Fill( fImpactParameter);
 	DEBUG(3, "impact parameter has been filled" );
+	FillTrackTable();
+	DEBUG(3, "track table filled");
 	Fill_QA_plot( fEta_min, fEta_max );
 	DEBUG(3, "QA Plot filled");
 
@@ -419,11 +445,10 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	TComplex QnB_star[kNH];
 
 	//--------------- Calculate Qn--------------------
-	for(int ih=0; ih<kNH; ih++){
-		QnA[ih] = CalculateQnSP( Eta_config[kSubA][kMin], Eta_config[kSubA][kMax], ih);
-		QnB[ih] = CalculateQnSP( Eta_config[kSubB][kMin], Eta_config[kSubB][kMax], ih);
+	CalculateQnSPAllHarmonics( Eta_config[kSubA][kMin], Eta_config[kSubA][kMax], QnA );
+	CalculateQnSPAllHarmonics( Eta_config[kSubB][kMin], Eta_config[kSubB][kMax], QnB );
+	for(int ih=0; ih<kNH; ih++)
 		QnB_star[ih] = TComplex::Conjugate ( QnB[ih] ) ;
-	}
 	NSubTracks[kSubA] = QnA[0].Re(); // this is number of tracks in Sub A
 	NSubTracks[kSubB] = QnB[0].Re(); // this is number of tracks in Sub B
 	
@@ -463,17 +488,24 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 
 	//************************************************************************
 
-	TComplex V4V2starv2_2 =	QnA[4] *TComplex::Power( QnB_star[2] ,2) * vn2[2][1] ;
-	TComplex V4V2starv2_4 = QnA[4] * TComplex::Power( QnB_star[2], 2) * vn2[2][2] ;
-	TComplex V4V2star = QnA[4] * TComplex::Power( QnB_star[2], 2 );
+	// powers of QnB* used by the nonlinear correlators
+	TComplex QnB_star_pow[kH4][nKL];
+	for(int ih=kH2; ih<=kH3; ih++){
+		for(int ik=2; ik<nKL; ik++)
+			QnB_star_pow[ih][ik] = TComplex::Power( QnB_star[ih], ik );
+	}
+
+	TComplex V4V2starv2_2 =	QnA[4] *QnB_star_pow[2][2] * vn2[2][1] ;
+	TComplex V4V2starv2_4 = QnA[4] * QnB_star_pow[2][2] * vn2[2][2] ;
+	TComplex V4V2star = QnA[4] * QnB_star_pow[2][2];
 	TComplex V5V2starV3starv2_2 = QnA[5] * QnB_star[2] * QnB_star[3] * vn2[2][1] ;
 	TComplex V5V2starV3star = QnA[5] * QnB_star[2] * QnB_star[3] ;
 	TComplex V5V2starV3startv3_2 = QnA[5] * QnB_star[2] * QnB_star[3] * vn2[3][1];
-	TComplex V6V2star_3 = QnA[6] * TComplex::Power( QnB_star[2] , 3) ;
-	TComplex V6V3star_2 = QnA[6] * TComplex::Power( QnB_star[3], 2) ;
-	TComplex V7V2star_2V3star = QnA[7] * TComplex::Power( QnB_star[2] , 2) * QnB_star[3];
-	TComplex V8V2starV3star_2 = QnA[8] * QnB_star[2] * TComplex::Power(QnB_star[3],2);
-	TComplex V8V2star_4 = QnA[8] * TComplex::Power(QnB_star[2],4);
+	TComplex V6V2star_3 = QnA[6] * QnB_star_pow[2][3] ;
+	TComplex V6V3star_2 = QnA[6] * QnB_star_pow[3][2] ;
+	TComplex V7V2star_2V3star = QnA[7] * QnB_star_pow[2][2] * QnB_star[3];
+	TComplex V8V2starV3star_2 = QnA[8] * QnB_star[2] * QnB_star_pow[3][2];
+	TComplex V8V2star_4 = QnA[8] * QnB_star_pow[2][4];
 
 	// New correlators (Modified by You's correction term for self-correlations)
 	TComplex nV4V2star = (QnA[4] * QnB_star[2] * QnB_star[2]) -( 1./(NSubTracks[1]-1) * QnA[4] * QnB_star[4] );
@@ -576,32 +608,16 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		const int SCNH = 9; // 0, 1, 2(v2), 3(v3), 4(v4), 5(v5)
 		Double_t ptbin_borders[N_ptbins+1] = {0.2, 0.4, 0.6, 0.8, 1.0, 1.25, 1.5, 2.0, 5.0};
 		//init
-		TComplex QnA_pt[SCNH][N_ptbins];
-		TComplex QnB_pt[SCNH][N_ptbins];
-		TComplex QnB_pt_star[SCNH][N_ptbins];
-		for(int ih=2; ih<SCNH; ih++){
-			for(int ipt=0; ipt<N_ptbins; ipt++){
-				QnA_pt[ih][ipt] = TComplex(0,0);
-				QnB_pt[ih][ipt] = TComplex(0,0);
-				QnB_pt_star[ih][ipt] = TComplex(0,0);
-			}
-		}
+		TComplex QnA_pt[kNH][N_ptbins];
+		TComplex QnB_pt[kNH][N_ptbins];
+		TComplex QnB_pt_star[kNH][N_ptbins];
 
 		// calculate Qn for each pt bins
+		CalculateQnPtAllHarmonics( Eta_config[kSubA][0], Eta_config[kSubA][1], ptbin_borders, QnA_pt );
+		CalculateQnPtAllHarmonics( Eta_config[kSubB][0], Eta_config[kSubB][1], ptbin_borders, QnB_pt );
 		for(int ih=2; ih<SCNH; ih++){
-			for(int ipt=0; ipt<N_ptbins; ipt++){
-				Double_t pt_bin_min = ptbin_borders[ipt];
-				Double_t pt_bin_max = ptbin_borders[ipt+1];
-				Double_t QAReal=Get_Qn_Real_pt( Eta_config[kSubA][0], Eta_config[kSubA][1], ih, ipt, pt_bin_min, pt_bin_max);
-				Double_t QAImag=Get_Qn_Img_pt(  Eta_config[kSubA][0], Eta_config[kSubA][1], ih, ipt, pt_bin_min, pt_bin_max);
-
-				Double_t QBReal=Get_Qn_Real_pt( Eta_config[kSubB][0], Eta_config[kSubB][1], ih, ipt, pt_bin_min, pt_bin_max);
-				Double_t QBImag=Get_Qn_Img_pt(  Eta_config[kSubB][0], Eta_config[kSubB][1], ih, ipt, pt_bin_min, pt_bin_max);
-
-				QnA_pt[ih][ipt]= TComplex(QAReal, QAImag);
-				QnB_pt[ih][ipt]= TComplex(QBReal, QBImag);
+			for(int ipt=0; ipt<N_ptbins; ipt++)
 				QnB_pt_star[ih][ipt] = TComplex::Conjugate( QnB_pt[ih][ipt] ) ;
-			}
 		}
 
 		for(int ipt=0; ipt<N_ptbins; ipt++){
@@ -639,18 +655,23 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		Double_t QC_4p_value[kNH][kNH];
 		Double_t QC_2p_value[kNH];
 
+		// normalisations, the same for all harmonics
+		const Double_t four_0000 = Four(0,0,0,0).Re();
+		const Double_t two_00 = Two(0,0).Re();
+		const Double_t two_00_eta10 = (QvectorQCeta10[0][kSubA]*QvectorQCeta10[0][kSubB]).Re();
+
 		Double_t event_weight_four = 1.0;
 		Double_t event_weight_two = 1.0;
 		Double_t event_weight_two_eta10 = 1.0;
 		if(IsEbEWeighted == kTRUE){
-			event_weight_four = Four(0,0,0,0).Re();
-			event_weight_two = Two(0,0).Re();
-			event_weight_two_eta10 = (QvectorQCeta10[0][kSubA]*QvectorQCeta10[0][kSubB]).Re();
+			event_weight_four = four_0000;
+			event_weight_two = two_00;
+			event_weight_two_eta10 = two_00_eta10;
 		}
 
 		for(int ih=2; ih < kNH; ih++){
 			for(int ihh=2; ihh<ih; ihh++){
-				TComplex scfour = Four( ih, ihh, -ih, -ihh ) / Four(0,0,0,0).Re();
+				TComplex scfour = Four( ih, ihh, -ih, -ihh ) / four_0000;
 				
 				fh_SC_with_QC_4corr[ih][ihh][fCBin]->Fill( scfour.Re(), event_weight_four );
 				QC_4p_value[ih][ihh] = scfour.Re();
@@ -661,13 +682,13 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 			// two(2,2) = Q2 Q2* - Q0 = Q2Q2* - M
 			// two(0,0) = Q0 Q0* - Q0 = M^2 - M
 			//two[ih] = Two(ih, -ih) / Two(0,0).Re();
-			TComplex sctwo = Two(ih, -ih) / Two(0,0).Re();
+			TComplex sctwo = Two(ih, -ih) / two_00;
 			fh_SC_with_QC_2corr[ih][fCBin]->Fill( sctwo.Re(), event_weight_two );
 			QC_2p_value[ih] = sctwo.Re();
 			// fill single vn  with QC without EtaGap as method 2
 			fSingleVn[ih][2] = TMath::Sqrt(sctwo.Re());
 			
-			TComplex sctwo10 = (QvectorQCeta10[ih][kSubA]*TComplex::Conjugate(QvectorQCeta10[ih][kSubB])) / (QvectorQCeta10[0][kSubA]*QvectorQCeta10[0][kSubB]).Re();
+			TComplex sctwo10 = (QvectorQCeta10[ih][kSubA]*TComplex::Conjugate(QvectorQCeta10[ih][kSubB])) / two_00_eta10;
 			fh_SC_with_QC_2corr_eta10[ih][fCBin]->Fill( sctwo10.Re(), event_weight_two_eta10 );
 			// fill single vn with QC method with Eta Gap as method 1
 			fSingleVn[ih][1] = TMath::Sqrt(sctwo10.Re());
@@ -716,22 +737,14 @@ void AliJFFlucAnalysis::Terminate(Option_t *)
 //________________________________________________________________________
 void AliJFFlucAnalysis::Fill_QA_plot( Double_t eta1, Double_t eta2 )
 {
-	Long64_t ntracks = fInputList->GetEntriesFast();
+	// uses the track table of the event (FillTrackTable)
+	Long64_t ntracks = fTrkPt.size();
 	for( Long64_t it=0; it< ntracks; it++){
-		AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
-		Double_t pt = itrack->Pt();
-		Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
-		Double_t eta = itrack->Eta();
-		int isub = -1;
-		if( eta < 0 )
-			isub = 0;
-		if( eta > 0 )
-			isub = 1;
-		Double_t phi = itrack->Phi();
-		Double_t phi_module_corr =1;
-		if( IsPhiModule == kTRUE){
-			phi_module_corr = h_phi_module[fCBin][isub]->GetBinContent( (h_phi_module[fCBin][isub]->GetXaxis()->FindBin( phi )) );
-		}
+		Double_t pt = fTrkPt[it];
+		Double_t effCorr = fTrkEffCorr[it];
+		Double_t eta = fTrkEta[it];
+		Double_t phi = fTrkPhi[it];
+		Double_t phi_module_corr = fTrkPhiModule[it];
 		//
 		if( TMath::Abs(eta) > eta1 && TMath::Abs(eta) < eta2 ){
 			fh_eta[fCBin]->Fill(eta , 1./ effCorr );
@@ -884,11 +897,9 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(){
 		}
 	} // for max harmonics
 	//Calculate Q-vector with particle loop
-	Long64_t ntracks = fInputList->GetEntriesFast(); // all tracks from Task input
+	Long64_t ntracks = fTrkEta.size(); // all tracks from Task input, in the track table
 	for( Long64_t it=0; it<ntracks; it++){
-		AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
-		Double_t phi = itrack->Phi();
-		Double_t eta = itrack->Eta();
+		Double_t eta = fTrkEta[it];
 		// track Eta cut Note! pt cuts already applied in AliJFFlucTask.cxx
 		// Do we need arbitary Eta cut for QC method?
 		// fixed eta ranged -0.8 < eta < 0.8 for QC
@@ -900,16 +911,19 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(){
 			continue;
 		/////////////////////////////////////////////////
 
+		const Double_t *cosphi = &fTrkCos[it*kNH];
+		const Double_t *sinphi = &fTrkSin[it*kNH];
 		for(int ih=0; ih<kNH; ih++){
+			TComplex qn( cosphi[ih], sinphi[ih] );
 			for(int ik=0; ik<nKL; ik++){
-				QvectorQC[ih] += TComplex( TMath::Cos(ih*phi), TMath::Sin(ih*phi) );
+				QvectorQC[ih] += qn;
 				// this is not working (there are no eta gap for +0.6, +0.61 in this way..
 				// fix this as like SP -> 2 sub event //
 				if( TMath::Abs(eta) > 0.5 ){  // this is for Noramlized SC ( denominator need eta gap )
 					int isub = 0;
 					if( eta > 0 )
 						isub = 1; // what about eta=0?
-					QvectorQCeta10[ih][isub] += TComplex( TMath::Cos(ih*phi), TMath::Sin(ih*phi) );
+					QvectorQCeta10[ih][isub] += qn;
 				}
 			}
 		}
@@ -952,6 +966,129 @@ TComplex AliJFFlucAnalysis::Four( int n1, int n2, int n3, int n4){
 		+ 2.*Q(n2,1)*Q(n1+n3+n4,3)+2.*Q(n1,1)*Q(n2+n3+n4,3)-6.*Q(n1+n2+n3+n4,4);
 	return four;
 }
+//________________________________________________________________________
+void AliJFFlucAnalysis::FillTrackTable(){
+	// One pass over the input tracks: kinematics, efficiency and phi modulation
+	// corrections, and cos(ih*phi), sin(ih*phi) for all harmonics.
+	// The SP, pt dependent and QC Q-vectors and the QA plots are built from this table.
+	Long64_t ntracks = fInputList->GetEntriesFast();
+	fTrkPt.resize(ntracks);
+	fTrkEta.resize(ntracks);
+	fTrkPhi.resize(ntracks);
+	fTrkEffCorr.resize(ntracks);
+	fTrkPhiModule.resize(ntracks);
+	fTrkWeight.resize(ntracks);
+	fTrkCos.resize(ntracks*kNH);
+	fTrkSin.resize(ntracks*kNH);
+	for( Long64_t it=0; it<ntracks; it++){
+		AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
+		Double_t pt = itrack->Pt();
+		Double_t eta = itrack->Eta();
+		Double_t phi = itrack->Phi();
+		int isub = -1;
+		if( eta < 0 )
+			isub = 0;
+		if( eta > 0 )
+			isub = 1;
+		Double_t phi_module_corr = 1;
+		if( IsPhiModule == kTRUE){
+			phi_module_corr = h_phi_module[fCBin][isub]->GetBinContent( (h_phi_module[fCBin][isub]->GetXaxis()->FindBin( phi )) );
+		}
+		Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent );
+
+		fTrkPt[it] = pt;
+		fTrkEta[it] = eta;
+		fTrkPhi[it] = phi;
+		fTrkEffCorr[it] = effCorr;
+		fTrkPhiModule[it] = phi_module_corr;
+		fTrkWeight[it] = 1./effCorr * phi_module_corr;
+		for(int ih=0; ih<kNH; ih++){
+			fTrkCos[it*kNH+ih] = TMath::Cos(ih*phi);
+			fTrkSin[it*kNH+ih] = TMath::Sin(ih*phi);
+		}
+	}
+}
+//________________________________________________________________________
+void AliJFFlucAnalysis::CalculateQnSPAllHarmonics( Double_t eta1, Double_t eta2, TComplex *Qn )
+{
+	// Qn of all harmonics in eta1 <= eta <= eta2 from the track table (same as CalculateQnSP)
+	Double_t QnRe[kNH], QnIm[kNH];
+	for(int ih=0; ih<kNH; ih++){
+		QnRe[ih] = 0;
+		QnIm[ih] = 0;
+	}
+	Double_t Sub_Ntrk = 0; // number of Tracks * effCorr * phi modulation factor
+	Long64_t ntracks = fTrkEta.size();
+	for(Long64_t it=0; it< ntracks; it++){
+		Double_t eta = fTrkEta[it];
+		if( eta < eta1 || eta > eta2)
+			continue; // eta cut
+		Double_t weight = fTrkWeight[it];
+		const Double_t *cosphi = &fTrkCos[it*kNH];
+		const Double_t *sinphi = &fTrkSin[it*kNH];
+		for(int ih=0; ih<kNH; ih++){
+			QnRe[ih] += weight * cosphi[ih];
+			QnIm[ih] += weight * sinphi[ih];
+		}
+		Sub_Ntrk += weight;
+	}
+
+	for(int ih=0; ih<kNH; ih++){
+		Qn[ih] = TComplex( QnRe[ih], QnIm[ih] );
+		if( ih !=0)
+			Qn[ih] /= Sub_Ntrk; // Use Qn[0] as total number of tracks(*eff)
+	}
+}
+//________________________________________________________________________
+void AliJFFlucAnalysis::CalculateQnPtAllHarmonics( Double_t eta1, Double_t eta2, const Double_t *ptBorders, TComplex Qn[kNH][N_ptbins] )
+{
+	// Qn of the harmonics 2..kNH-1 in eta1 < eta < eta2 for each pt bin from the track table
+	// (same as Get_Qn_Real_pt and Get_Qn_Img_pt), also sets NSubTracks_pt
+	if( eta1 > eta2) cout << "ERROR eta1 should be smaller than eta2!!!" << endl;
+	Double_t QnRe[kNH][N_ptbins], QnIm[kNH][N_ptbins];
+	Double_t Sub_Ntrk[N_ptbins];
+	for(int ipt=0; ipt<N_ptbins; ipt++){
+		for(int ih=0; ih<kNH; ih++){
+			QnRe[ih][ipt] = 0;
+			QnIm[ih][ipt] = 0;
+		}
+		Sub_Ntrk[ipt] = 0;
+	}
+
+	Long64_t ntracks = fTrkEta.size();
+	for( Long64_t it=0; it< ntracks; it++){
+		Double_t eta = fTrkEta[it];
+		if( !(eta > eta1 && eta < eta2) )
+			continue;
+		Double_t pt = fTrkPt[it];
+		int ipt = -1;
+		for(int ib=0; ib<N_ptbins; ib++){
+			if( pt > ptBorders[ib] && pt < ptBorders[ib+1] ){
+				ipt = ib;
+				break;
+			}
+		}
+		if( ipt < 0 )
+			continue;
+		Double_t weight = fTrkWeight[it];
+		const Double_t *cosphi = &fTrkCos[it*kNH];
+		const Double_t *sinphi = &fTrkSin[it*kNH];
+		for(int ih=2; ih<kNH; ih++){
+			QnRe[ih][ipt] += weight * cosphi[ih];
+			QnIm[ih][ipt] += weight * sinphi[ih];
+		}
+		Sub_Ntrk[ipt] = Sub_Ntrk[ipt] + weight;
+	}
+
+	int iside = 0; // eta -
+	if (eta1 > 0 )
+		iside = 1; // eta +
+	for(int ipt=0; ipt<N_ptbins; ipt++){
+		for(int ih=2; ih<kNH; ih++)
+			Qn[ih][ipt] = TComplex( QnRe[ih][ipt] / Sub_Ntrk[ipt], QnIm[ih][ipt] / Sub_Ntrk[ipt] );
+		NSubTracks_pt[iside][ipt] = Sub_Ntrk[ipt];
+	}
+}
 //__________________________________________________________________________
 void AliJFFlucAnalysis::SetPhiModuleHistos( int cent, int sub, TH1D *hModuledPhi){
 	// hPhi histo setter
@@ -163,7 +163,20 @@ private:
 	AliJTH1D fh_QvectorQCphi;//!
 	AliJTH1D fh_evt_SP_QC_ratio_2p;//! // check SP QC evt by evt ratio
 	AliJTH1D fh_evt_SP_QC_ratio_4p;//! // check SP QC evt by evt ratio
-	ClassDef(AliJFFlucAnalysis, 1); // example of analysis
+
+	// per event track table, filled once and used for all Q-vectors
+	void FillTrackTable();
+	void CalculateQnSPAllHarmonics( Double_t eta1, Double_t eta2, TComplex *Qn );
+	void CalculateQnPtAllHarmonics( Double_t eta1, Double_t eta2, const Double_t *ptBorders, TComplex Qn[kNH][N_ptbins] );
+	std::vector<Double_t> fTrkPt;//!
+	std::vector<Double_t> fTrkEta;//!
+	std::vector<Double_t> fTrkPhi;//!
+	std::vector<Double_t> fTrkEffCorr;//! // efficiency correction
+	std::vector<Double_t> fTrkPhiModule;//! // phi modulation correction
+	std::vector<Double_t> fTrkWeight;//! // 1/effCorr * phi modulation correction
+	std::vector<Double_t> fTrkCos;//! // cos(ih*phi) [itrack*kNH+ih]
+	std::vector<Double_t> fTrkSin;//! // sin(ih*phi) [itrack*kNH+ih]
+	ClassDef(AliJFFlucAnalysis, 2); // example of analysis
 };
 
 #endif
@@ -0,0 +1,72 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// Tracks of one pooled event stored as contiguous columns
+
+#include "AliJFlatEvent.h"
+#include "AliJBaseTrack.h"
+
+//______________________________________________________________________________
+AliJFlatEvent::AliJFlatEvent() :
+  fN(0),
+  fPt(),
+  fEta(),
+  fPhi(),
+  fEff(),
+  fMass(),
+  fCharge(),
+  fAssocBin(),
+  fParticleType()
+{
+  // constructor
+}
+
+//______________________________________________________________________________
+void AliJFlatEvent::Clear(){
+  // remove the tracks, the allocated memory is kept for the next event
+  fN = 0;
+  fPt.clear();
+  fEta.clear();
+  fPhi.clear();
+  fEff.clear();
+  fMass.clear();
+  fCharge.clear();
+  fAssocBin.clear();
+  fParticleType.clear();
+}
+
+//______________________________________________________________________________
+void AliJFlatEvent::Add(const AliJBaseTrack *tk){
+  // store the track at the end of the columns
+  fPt.push_back( tk->Pt() );
+  fEta.push_back( tk->Eta() );
+  fPhi.push_back( tk->Phi() );
+  fEff.push_back( tk->GetTrackEff() );
+  fMass.push_back( tk->M() );
+  fCharge.push_back( tk->GetCharge() );
+  fAssocBin.push_back( tk->GetAssocBin() );
+  fParticleType.push_back( tk->GetParticleType() );
+  fN++;
+}
+
+//______________________________________________________________________________
+void AliJFlatEvent::FillTrack(int i, AliJBaseTrack *tk) const {
+  // set tk to the stored track i (for the correlation classes without flat mixing)
+  tk->SetPtEtaPhiM( fPt[i], fEta[i], fPhi[i], fMass[i] );
+  tk->SetTrackEff( fEff[i] );
+  tk->SetCharge( fCharge[i] );
+  tk->SetAssocBin( fAssocBin[i] );
+  tk->SetParticleType( fParticleType[i] );
+}
@@ -0,0 +1,54 @@
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice */
+
+// Tracks of one pooled event stored as contiguous columns
+
+//===========================================================
+// AliJFlatEvent.h
+//
+//   Used by AliJEventPool instead of a TClonesArray of track
+//   copies (see AliJEventPool::SetUseFlatPool). One entry per
+//   track in each column, filled from AliJBaseTrack.
+//===========================================================
+
+#ifndef ALIJFLATEVENT_H
+#define ALIJFLATEVENT_H
+
+#include <vector>
+
+using namespace std;
+
+class AliJBaseTrack;
+
+class AliJFlatEvent {
+
+  public:
+    AliJFlatEvent();
+    virtual ~AliJFlatEvent(){;}
+
+    void Clear();
+    void Add(const AliJBaseTrack *tk);
+    void FillTrack(int i, AliJBaseTrack *tk) const; // set tk to the stored track i
+
+    int          GetEntries()     const { return fN; }
+    const float *GetPt()          const { return fPt.empty() ? 0 : &fPt[0]; }
+    const float *GetEta()         const { return fEta.empty() ? 0 : &fEta[0]; }
+    const float *GetPhi()         const { return fPhi.empty() ? 0 : &fPhi[0]; }
+    const float *GetTrackEff()    const { return fEff.empty() ? 0 : &fEff[0]; }
+    const char  *GetCharge()      const { return fCharge.empty() ? 0 : &fCharge[0]; }
+    const short *GetAssocBin()    const { return fAssocBin.empty() ? 0 : &fAssocBin[0]; }
+
+  protected:
+    int           fN;             // number of stored tracks
+    vector<float> fPt;            // pt
+    vector<float> fEta;           // eta
+    vector<float> fPhi;           // phi
+    vector<float> fEff;           // track efficiency
+    vector<float> fMass;          // mass, only needed to rebuild the tracks
+    vector<char>  fCharge;        // charge
+    vector<short> fAssocBin;      // associated pt bin
+    vector<short> fParticleType;  // particle type
+
+};
+
+#endif
@@ -232,6 +232,7 @@ void AliJIaaAnalysis::UserCreateOutputObjects(){
 
 	// EventPool for Mixing
 	fassocPool   = new AliJEventPool( fcard, fhistos, fcorrelations, fjassoc);
+	fassocPool->SetUseFlatPool( fcard->UseFlatEventPool() );
 
 	fphotonList = new TClonesArray(kParticleProtoType[kJPhoton],1500);
 	fchargedHadronList  = new TClonesArray(kParticleProtoType[kJHadron],1500);
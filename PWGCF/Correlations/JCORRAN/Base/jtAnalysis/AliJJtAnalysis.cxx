@@ -377,6 +377,7 @@ void AliJJtAnalysis::UserCreateOutputObjects(){
   
   // EventPool for Mixing
   fassocPool   = new AliJEventPool( fcard, fhistos, fcorrelations, fjassoc);
+  fassocPool->SetUseFlatPool( fcard->UseFlatEventPool() );
   
   fphotonList = new TClonesArray(kParticleProtoType[kJPhoton],1500);
   fchargedHadronList  = new TClonesArray(kParticleProtoType[fMCTruthRun ? kJHadronMC : kJHadron],1500);
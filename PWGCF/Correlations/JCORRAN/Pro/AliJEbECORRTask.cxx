@@ -231,6 +231,7 @@ void AliJEbECORRTask::UserCreateOutputObjects(){
 
 	fcorrelations = new AliJCorrelations(fCard, fHistos);
 	fassocPool   = new AliJEventPool( fCard, fHistos, fcorrelations, kJHadron);
+	fassocPool->SetUseFlatPool( fCard->UseFlatEventPool() );
 	fEbePercentile = new AliJEbePercentile(fCard, ebePercentileInputFileName);
 	fEbECentBinBorders = fCard->GetVector("EbECentBinBorders");
 
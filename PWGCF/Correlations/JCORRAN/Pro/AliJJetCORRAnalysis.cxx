@@ -157,6 +157,7 @@ void AliJJetCORRAnalysis::UserCreateOutputObjects(){
 
 	fcorrelations = new AliJCorrelations(fCard, fHistos);
 	fassocPool   = new AliJEventPool( fCard, fHistos, fcorrelations, kJHadron);
+	fassocPool->SetUseFlatPool( fCard->UseFlatEventPool() );
 
 	fEfficiency = new AliJEfficiency();
 	fEfficiency->SetMode( fCard->Get("EfficiencyMode") ); // 0:NoEff, 1:Period 2:RunNum 3:Auto
@@ -26,6 +26,12 @@ AliFemtoPair::AliFemtoPair():
   fDKLong(0.0),
   fCVK(0.0),
   fKStarCalc(0.0),
+  fKinParNotCalculated(1),
+  fQInvCalc(0.0),
+  fKTCalc(0.0),
+  fQOutCMSCalc(0.0),
+  fQSideCMSCalc(0.0),
+  fQLongCMSCalc(0.0),
   fNonIdParNotCalculatedGlobal(0),
   fMergingParNotCalculated(0),
   fWeightedAvSep(0.0),
@@ -64,6 +70,12 @@ AliFemtoPair::AliFemtoPair(AliFemtoParticle* a, AliFemtoParticle* b):
   fDKLong(0.0),
   fCVK(0.0),
   fKStarCalc(0.0),
+  fKinParNotCalculated(1),
+  fQInvCalc(0.0),
+  fKTCalc(0.0),
+  fQOutCMSCalc(0.0),
+  fQSideCMSCalc(0.0),
+  fQLongCMSCalc(0.0),
   fNonIdParNotCalculatedGlobal(0),
   fMergingParNotCalculated(0),
   fWeightedAvSep(0.0),
@@ -133,6 +145,12 @@ AliFemtoPair::AliFemtoPair(const AliFemtoPair &aPair):
   fDKLong(aPair.fDKLong),
   fCVK(aPair.fCVK),
   fKStarCalc(aPair.fKStarCalc),
+  fKinParNotCalculated(aPair.fKinParNotCalculated),
+  fQInvCalc(aPair.fQInvCalc),
+  fKTCalc(aPair.fKTCalc),
+  fQOutCMSCalc(aPair.fQOutCMSCalc),
+  fQSideCMSCalc(aPair.fQSideCMSCalc),
+  fQLongCMSCalc(aPair.fQLongCMSCalc),
   fNonIdParNotCalculatedGlobal(aPair.fNonIdParNotCalculatedGlobal),
   fMergingParNotCalculated(aPair.fMergingParNotCalculated),
   fWeightedAvSep(aPair.fWeightedAvSep),
@@ -179,6 +197,13 @@ AliFemtoPair& AliFemtoPair::operator=(const AliFemtoPair &aPair)
   fCVK = aPair.fCVK;
   fKStarCalc = aPair.fKStarCalc;
 
+  fKinParNotCalculated = aPair.fKinParNotCalculated;
+  fQInvCalc = aPair.fQInvCalc;
+  fKTCalc = aPair.fKTCalc;
+  fQOutCMSCalc = aPair.fQOutCMSCalc;
+  fQSideCMSCalc = aPair.fQSideCMSCalc;
+  fQLongCMSCalc = aPair.fQLongCMSCalc;
+
   fNonIdParNotCalculatedGlobal = aPair.fNonIdParNotCalculatedGlobal;
 
   fMergingParNotCalculated = aPair.fMergingParNotCalculated;
@@ -226,13 +251,50 @@ double AliFemtoPair::MInv() const
     return (tInvariantMass);
 }
 //_________________
-double AliFemtoPair::KT() const
+void AliFemtoPair::CalcKinPar() const
 {
+  // Calculate once per pair the relative momentum variables used by most
+  // cuts and correlation functions: qinv, kT and the q components in LCMS
+  const AliFemtoLorentzVector &tmp1 = fTrack1->FourMomentum();
+  const AliFemtoLorentzVector &tmp2 = fTrack2->FourMomentum();
+
+  // invariant relative momentum
+  AliFemtoLorentzVector tDiff = (tmp1 - tmp2);
+  fQInvCalc = -1. * tDiff.m();
+
   // transverse momentum
-  double tmp = (fTrack1->FourMomentum() + fTrack2->FourMomentum()).Perp();
-  tmp *= .5;
+  fKTCalc = (tmp1 + tmp2).Perp();
+  fKTCalc *= .5;
+
+  double x1 = tmp1.x();  double y1 = tmp1.y();
+  double x2 = tmp2.x();  double y2 = tmp2.y();
+
+  double dx = x1 - x2;  double xt = x1 + x2;
+  double dy = y1 - y2;  double yt = y1 + y2;
+  double k1 = ::sqrt(xt*xt+yt*yt);
+
+  // relative momentum out and side components in lab frame
+  if (k1 != 0) {
+    fQOutCMSCalc = (dx*xt+dy*yt)/k1;
+    fQSideCMSCalc = 2.0*(x2*y1-x1*y2)/k1;
+  } else {
+    fQOutCMSCalc = 0;
+    fQSideCMSCalc = 0;
+  }
 
-  return (tmp);
+  // relative momentum long component in LCMS
+  double dz = tmp1.z() - tmp2.z();
+  double zz = tmp1.z() + tmp2.z();
+
+  double dt = tmp1.t() - tmp2.t();
+  double tt = tmp1.t() + tmp2.t();
+
+  double beta = zz/tt;
+  double gamma = 1.0/TMath::Sqrt((1.-beta)*(1.+beta));
+
+  fQLongCMSCalc = gamma*(dz - beta*dt);
+
+  fKinParNotCalculated = 0;
 }
 //_________________
 double AliFemtoPair::Rap() const
@@ -352,68 +414,6 @@ void AliFemtoPair::QYKPPF(double& qP, double& qT, double& q0) const
   qT = l.vect().Perp();
   q0 = l.e();
 }
-//_________________
-double AliFemtoPair::QOutCMS() const
-{
-  // relative momentum out component in lab frame
-    AliFemtoThreeVector tmp1 = fTrack1->FourMomentum().vect();
-    AliFemtoThreeVector tmp2 = fTrack2->FourMomentum().vect();
-
-    double dx = tmp1.x() - tmp2.x();
-    double xt = tmp1.x() + tmp2.x();
-
-    double dy = tmp1.y() - tmp2.y();
-    double yt = tmp1.y() + tmp2.y();
-
-    double k1 = (::sqrt(xt*xt+yt*yt));
-    double k2 = (dx*xt+dy*yt);
-    double tmp;
-
-    if(k1!=0) tmp= k2/k1;
-    else tmp=0;
-
-    return (tmp);
-}
-//_________________
-double AliFemtoPair::QSideCMS() const
-{
-  // relative momentum side component in lab frame
-    AliFemtoThreeVector tmp1 = fTrack1->FourMomentum().vect();
-    AliFemtoThreeVector tmp2 = fTrack2->FourMomentum().vect();
-
-    double x1 = tmp1.x();  double y1 = tmp1.y();
-    double x2 = tmp2.x();  double y2 = tmp2.y();
-
-    double xt = x1+x2;  double yt = y1+y2;
-    double k1 = ::sqrt(xt*xt+yt*yt);
-
-    double tmp;
-    if(k1!=0) tmp= 2.0*(x2*y1-x1*y2)/k1;
-    else tmp=0;
-
-    return (tmp);
-}
-
-//_________________________
-double AliFemtoPair::QLongCMS() const
-{
-  // relative momentum component in lab frame
-    AliFemtoLorentzVector tmp1 = fTrack1->FourMomentum();
-    AliFemtoLorentzVector tmp2 = fTrack2->FourMomentum();
-
-    double dz = tmp1.z() - tmp2.z();
-    double zz = tmp1.z() + tmp2.z();
-
-    double dt = tmp1.t() - tmp2.t();
-    double tt = tmp1.t() + tmp2.t();
-
-    double beta = zz/tt;
-    double gamma = 1.0/TMath::Sqrt((1.-beta)*(1.+beta));
-
-    double temp = gamma*(dz - beta*dt);
-    return (temp);
-}
-
 //________________________________
 double AliFemtoPair::QOutPf() const
 {
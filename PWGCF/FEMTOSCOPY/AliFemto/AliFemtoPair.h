@@ -172,6 +172,14 @@ private:
   mutable double fKStarCalc; // momemntum of first particle in PRF - k*
   void CalcNonIdPar() const;
 
+  mutable short fKinParNotCalculated; // Set to 1 when qinv, kT and the LCMS q components have to be (re)calculated
+  mutable double fQInvCalc;     // qinv
+  mutable double fKTCalc;       // kT
+  mutable double fQOutCMSCalc;  // q out in LCMS
+  mutable double fQSideCMSCalc; // q side in LCMS
+  mutable double fQLongCMSCalc; // q long in LCMS
+  void CalcKinPar() const;
+
   mutable short fNonIdParNotCalculatedGlobal; // If global k* was calculated
  /* mutable double fDKSideGlobal;
   mutable double fDKOutGlobal;
@@ -228,6 +236,7 @@ private:
 
 inline void AliFemtoPair::ResetParCalculated(){
   fNonIdParNotCalculated=1;
+  fKinParNotCalculated=1;
   fNonIdParNotCalculatedGlobal=1;
   fMergingParNotCalculated=1;
   fMergingParNotCalculatedTrkV0Pos=1;
@@ -267,8 +276,24 @@ inline double AliFemtoPair::KStar() const{
   return fKStarCalc;
 }
 inline double AliFemtoPair::QInv() const {
-  AliFemtoLorentzVector tDiff = (fTrack1->FourMomentum()-fTrack2->FourMomentum());
-  return ( -1.* tDiff.m());
+  if(fKinParNotCalculated) CalcKinPar();
+  return fQInvCalc;
+}
+inline double AliFemtoPair::KT() const {
+  if(fKinParNotCalculated) CalcKinPar();
+  return fKTCalc;
+}
+inline double AliFemtoPair::QOutCMS() const {
+  if(fKinParNotCalculated) CalcKinPar();
+  return fQOutCMSCalc;
+}
+inline double AliFemtoPair::QSideCMS() const {
+  if(fKinParNotCalculated) CalcKinPar();
+  return fQSideCMSCalc;
+}
+inline double AliFemtoPair::QLongCMS() const {
+  if(fKinParNotCalculated) CalcKinPar();
+  return fQLongCMSCalc;
 }
 
 // Fabrice private <<<
@@ -575,6 +575,13 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
 
   const string type = typeIn;
 
+  // Dispatch on the pair type once, not for every pair and CF
+  const bool isReal = (type == "real"),
+             isMixed = (type == "mixed");
+  if (!isReal && !isMixed) {
+    cout << "Problem with pair type, type = " << type << endl;
+  }
+
   //  int swpart = ((long int) partCollection1) % 2;
 
   // Used to swap particle 1 & 2 in identical-particle analysis
@@ -604,8 +611,10 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
     tEndInnerLoop = partCollection1->end() ;     //   Inner loop goes to last particle
   }
 
-  // Create the pair outside the loop - only allocate once
-  AliFemtoPair* tPair = new AliFemtoPair;
+  // Create the pair outside the loop - only allocate once. The pair caches
+  // qinv, kT and the LCMS components, so the cut and all the CFs share them.
+  AliFemtoPair tPairObject;
+  AliFemtoPair* tPair = &tPairObject;
 
   // Begin the outer loop
   for (AliFemtoParticleConstIterator tPartIter1 = tStartOuterLoop;
@@ -648,22 +657,21 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
       }
 
       // If pair passes cut, loop over CF's and add pair to real/mixed
-      if (tmpPassPair) {
+      if (!tmpPassPair) {
+        continue;
+      }
+      if (isReal) {
         for (auto &tCorrFctn : *fCorrFctnCollection) {
-          if (type == "real")
-            tCorrFctn->AddRealPair(tPair);
-          else if(type == "mixed")
-            tCorrFctn->AddMixedPair(tPair);
-          else
-            cout << "Problem with pair type, type = " << type << endl;
-        } // loop over corellatoin functions
+          tCorrFctn->AddRealPair(tPair);
+        }
+      } else if (isMixed) {
+        for (auto &tCorrFctn : *fCorrFctnCollection) {
+          tCorrFctn->AddMixedPair(tPair);
+        }
       }
 
     }    // loop over second particle
   }      // loop over first particle
-
-  // we are done with the pair
-  delete tPair;
 }
 //_________________________
 void AliFemtoSimpleAnalysis::EventBegin(const AliFemtoEvent* ev)
@@ -276,6 +276,7 @@ AliDielectron::~AliDielectron()
   if (fSignalsMC) delete fSignalsMC;
   if (fCfManagerPair) delete fCfManagerPair;
   if (fHistoArray) delete fHistoArray;
+  fPairPool.Delete();
 }
 
 //________________________________________________________________
@@ -705,11 +706,12 @@ void AliDielectron::FillHistogramsTracks(TObjArray **tracks)
   //Fill track information, separately for the track array candidates
   for (Int_t i=0; i<2; ++i){
     className.Form("Pre_%s",fgkTrackClassNames[i]);
-    if (!fHistos->GetHistogramList()->FindObject(className.Data())) continue;
+    const Int_t trkClass=fHistos->GetClassIndex(className.Data());
+    if (trkClass<0) continue;
     Int_t ntracks=tracks[i]->GetEntriesFast();
     for (Int_t itrack=0; itrack<ntracks; ++itrack){
       AliDielectronVarManager::Fill(tracks[i]->UncheckedAt(itrack), values);
-      fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+      fHistos->FillClass(trkClass, AliDielectronVarManager::kNMaxValues, values);
     }
   }
 }
@@ -746,26 +748,27 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
 
   //Fill event information
   if (ev){
-    if (fHistos->GetHistogramList()->FindObject("Event")) {
-      fHistos->FillClass("Event", AliDielectronVarManager::kNMaxValues, AliDielectronVarManager::GetData());
+    const Int_t evClass=fHistos->GetClassIndex("Event");
+    if (evClass>=0) {
+      fHistos->FillClass(evClass, AliDielectronVarManager::kNMaxValues, AliDielectronVarManager::GetData());
     }
   }
 
   //Fill track information, separately for the track array candidates
   if (!pairInfoOnly){
     className2.Form("Track_%s",fgkPairClassNames[1]);  // unlike sign, SE only
+    const Int_t mergedtrkClass=fHistos->GetClassIndex(className2.Data());
     for (Int_t i=0; i<4; ++i){
       className.Form("Track_%s",fgkTrackClassNames[i]);
-      Bool_t mergedtrkClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
-      Bool_t trkClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-      if (!trkClass && !mergedtrkClass) continue;
+      const Int_t trkClass=fHistos->GetClassIndex(className.Data());
+      if (trkClass<0 && mergedtrkClass<0) continue;
       Int_t ntracks=fTracks[i].GetEntriesFast();
       for (Int_t itrack=0; itrack<ntracks; ++itrack){
         AliDielectronVarManager::Fill(fTracks[i].UncheckedAt(itrack), values);
-        if(trkClass)
-          fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
-        if(mergedtrkClass && i<2)
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values); //only ev1
+        if(trkClass>=0)
+          fHistos->FillClass(trkClass, AliDielectronVarManager::kNMaxValues, values);
+        if(mergedtrkClass>=0 && i<2)
+          fHistos->FillClass(mergedtrkClass, AliDielectronVarManager::kNMaxValues, values); //only ev1
       }
     }
   }
@@ -775,36 +778,36 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
   for (Int_t i=0; i<10; ++i){
     className.Form("Pair_%s",fgkPairClassNames[i]);
     className2.Form("Track_Legs_%s",fgkPairClassNames[i]);
-    Bool_t pairClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-    Bool_t legClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
-    if (!pairClass&&!legClass) continue;
+    const Int_t pairClass=fHistos->GetClassIndex(className.Data());
+    const Int_t legClass=fHistos->GetClassIndex(className2.Data());
+    if (pairClass<0&&legClass<0) continue;
     Int_t ntracks=PairArray(i)->GetEntriesFast();
     for (Int_t ipair=0; ipair<ntracks; ++ipair){
       AliDielectronPair *pair=static_cast<AliDielectronPair*>(PairArray(i)->UncheckedAt(ipair));
 
       //fill pair information
-      if (pairClass){
+      if (pairClass>=0){
         AliDielectronVarManager::Fill(pair, values);
-        fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+        fHistos->FillClass(pairClass, AliDielectronVarManager::kNMaxValues, values);
       }
 
       //fill leg information, don't fill the information twice
-      if (legClass){
+      if (legClass>=0){
         AliVParticle *d1=pair->GetFirstDaughterP();
         AliVParticle *d2=pair->GetSecondDaughterP();
         if (!arrLegs.FindObject(d1)){
           AliDielectronVarManager::Fill(d1, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
           arrLegs.Add(d1);
         }
         if (!arrLegs.FindObject(d2)){
           AliDielectronVarManager::Fill(d2, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
           arrLegs.Add(d2);
         }
       }
     }
-    if (legClass) arrLegs.Clear();
+    if (legClass>=0) arrLegs.Clear();
   }
 
 }
@@ -833,23 +836,23 @@ void AliDielectron::FillHistogramsPair(AliDielectronPair *pair,Bool_t fromPreFil
     className2.Form("Track_Legs_%s",fgkPairClassNames[type]);
   }
 
-  Bool_t pairClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-  Bool_t legClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
+  const Int_t pairClass=fHistos->GetClassIndex(className.Data());
+  const Int_t legClass=fHistos->GetClassIndex(className2.Data());
 
   //fill pair information
-  if (pairClass){
+  if (pairClass>=0){
     AliDielectronVarManager::Fill(pair, values);
-    fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+    fHistos->FillClass(pairClass, AliDielectronVarManager::kNMaxValues, values);
   }
 
-  if (legClass){
+  if (legClass>=0){
     AliVParticle *d1=pair->GetFirstDaughterP();
     AliDielectronVarManager::Fill(d1, values);
-    fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+    fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
 
     AliVParticle *d2=pair->GetSecondDaughterP();
     AliDielectronVarManager::Fill(d2, values);
-    fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+    fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
   }
 }
 
@@ -868,6 +871,8 @@ void AliDielectron::FillTrackArrays(AliVEvent * const ev, Int_t eventNr)
   for (Int_t itrack=0; itrack<ntracks; ++itrack){
     //get particle
     AliVParticle *particle=ev->GetTrack(itrack);
+    //compute the variables once for the cuts and the cut QA
+    AliDielectronVarManager::CacheObject(particle);
 
     //apply track cuts
     UInt_t cutmask=fTrackFilter.IsSelected(particle);
@@ -884,6 +889,7 @@ void AliDielectron::FillTrackArrays(AliVEvent * const ev, Int_t eventNr)
 
 
   }
+  AliDielectronVarManager::ClearCache();
 }
 
 //________________________________________________________________
@@ -1194,8 +1200,10 @@ void AliDielectron::PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1,
 
   Int_t ntrack1=arrTracks1.GetEntriesFast();
   Int_t ntrack2=arrTracks2.GetEntriesFast();
-  AliDielectronPair candidate;
-  candidate.SetKFUsage(fUseKF);
+  //MC labels only if the MC truth is available
+  const Bool_t hasMC=AliDielectronMC::Instance()->HasMCEvent();
+  AliDielectronPair &candidate=*GetPairCandidate();
+  candidate.SetPdgCode(0);
   // flag arrays for track removal
   Bool_t *bTracks1 = new Bool_t[ntrack1];
   for (Int_t itrack1=0; itrack1<ntrack1; ++itrack1) bTracks1[itrack1]=kFALSE;
@@ -1265,7 +1273,7 @@ void AliDielectron::PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1,
           }
 
           candidate.SetType(pairIndex);
-          candidate.SetLabel(AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,fPdgMother));
+          candidate.SetLabel(hasMC ? AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,fPdgMother) : -1);
           //relate to the production vertex
           //       if (AliDielectronVarManager::GetKFVertex()) candidate.SetProductionVertex(*AliDielectronVarManager::GetKFVertex());
 
@@ -1317,7 +1325,7 @@ void AliDielectron::PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1,
           }
 
           candidate.SetType(pairIndex);
-          candidate.SetLabel(AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,fPdgMother));
+          candidate.SetLabel(hasMC ? AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,fPdgMother) : -1);
           //relate to the production vertex
           //       if (AliDielectronVarManager::GetKFVertex()) candidate.SetProductionVertex(*AliDielectronVarManager::GetKFVertex());
 
@@ -1336,6 +1344,9 @@ void AliDielectron::PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1,
     }
   }
 
+  //the candidate goes back to the pool
+  fPairPool.Add(&candidate);
+
   //remove the tracks from the Track arrays
   for (Int_t itrack1=0; itrack1<ntrack1; ++itrack1){
     if(bTracks1[itrack1]) {
@@ -1402,21 +1413,33 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
   // select pairs and fill pair candidate arrays
   //
 
-  TObjArray arrTracks1=fTracks[arr1];
-  TObjArray arrTracks2=fTracks[arr2];
-
-  //process pre filter if set
-  if ((!fPreFilterAllSigns1) && (!fPreFilterUnlikeOnly1) && (!fPreFilterLikeOnly1) && ( fPairPreFilter1.GetCuts()->GetEntries()>0 ))  PairPreFilter(arr1, arr2, arrTracks1, arrTracks2, ev, 1);
-
-  if ((!fPreFilterAllSigns2) && (!fPreFilterUnlikeOnly2) && (!fPreFilterLikeOnly2) && ( fPairPreFilter2.GetCuts()->GetEntries()>0 ))  PairPreFilter(arr1, arr2, arrTracks1, arrTracks2, ev, 2);
+  //the pre filter of this pairing only removes tracks for it, it works on copies of the track arrays
+  const Bool_t preFilter1=(!fPreFilterAllSigns1) && (!fPreFilterUnlikeOnly1) && (!fPreFilterLikeOnly1) && ( fPairPreFilter1.GetCuts()->GetEntries()>0 );
+  const Bool_t preFilter2=(!fPreFilterAllSigns2) && (!fPreFilterUnlikeOnly2) && (!fPreFilterLikeOnly2) && ( fPairPreFilter2.GetCuts()->GetEntries()>0 );
+
+  TObjArray *arrTracks1=&fTracks[arr1];
+  TObjArray *arrTracks2=&fTracks[arr2];
+  TObjArray preFilterTracks1, preFilterTracks2;
+  if (preFilter1 || preFilter2) {
+    preFilterTracks1=fTracks[arr1];
+    preFilterTracks2=fTracks[arr2];
+    arrTracks1=&preFilterTracks1;
+    arrTracks2=&preFilterTracks2;
+
+    //process pre filter if set
+    if (preFilter1) PairPreFilter(arr1, arr2, preFilterTracks1, preFilterTracks2, ev, 1);
+    if (preFilter2) PairPreFilter(arr1, arr2, preFilterTracks1, preFilterTracks2, ev, 2);
+  }
 
   Int_t pairIndex=GetPairIndex(arr1,arr2);
 
-  Int_t ntrack1=arrTracks1.GetEntriesFast();
-  Int_t ntrack2=arrTracks2.GetEntriesFast();
+  Int_t ntrack1=arrTracks1->GetEntriesFast();
+  Int_t ntrack2=arrTracks2->GetEntriesFast();
 
-  AliDielectronPair *candidate=new AliDielectronPair;
-  candidate->SetKFUsage(fUseKF);
+  //MC labels only if the MC truth is available
+  const Bool_t hasMC=AliDielectronMC::Instance()->HasMCEvent();
+
+  AliDielectronPair *candidate=GetPairCandidate();
 
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
 
@@ -1425,23 +1448,29 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
     if (arr1==arr2) end=itrack1;
     for (Int_t itrack2=0; itrack2<end; ++itrack2){
       //create the pair (direct pointer to the memory by this daughter reference are kept also for ME)
-      candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1))), fPdgLeg1,
-                           &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
+      candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1->UncheckedAt(itrack1))), fPdgLeg1,
+                           &(*static_cast<AliVTrack*>(arrTracks2->UncheckedAt(itrack2))), fPdgLeg2);
       candidate->SetType(pairIndex);
 
-      Int_t label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,fPdgMother);
-      candidate->SetLabel(label);
-      if (label>-1) candidate->SetPdgCode(fPdgMother);
-      else candidate->SetPdgCode(0);
-
-      // check for gamma kf particle
-      label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,22);
-      if (label>-1 && fUseGammaTracks) {
-        candidate->SetGammaTracks(static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1)), fPdgLeg1,
-                                  static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2)), fPdgLeg2);
-      // should we set the pdgmothercode and the label
+      candidate->SetLabel(-1);
+      candidate->SetPdgCode(0);
+      if (hasMC) {
+        Int_t label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,fPdgMother);
+        candidate->SetLabel(label);
+        if (label>-1) candidate->SetPdgCode(fPdgMother);
+
+        // check for gamma kf particle
+        label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,22);
+        if (label>-1 && fUseGammaTracks) {
+          candidate->SetGammaTracks(static_cast<AliVTrack*>(arrTracks1->UncheckedAt(itrack1)), fPdgLeg1,
+                                    static_cast<AliVTrack*>(arrTracks2->UncheckedAt(itrack2)), fPdgLeg2);
+        // should we set the pdgmothercode and the label
+        }
       }
 
+      //compute the variables once for the cuts, CF, cut QA and histograms
+      AliDielectronVarManager::CacheObject(candidate);
+
       //pair cuts
       UInt_t cutMask=fPairFilter.IsSelected(candidate);
 
@@ -1463,12 +1492,25 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
       //add the candidate to the candidate array
       PairArray(pairIndex)->Add(candidate);
       //get a new candidate
-      candidate=new AliDielectronPair;
-      candidate->SetKFUsage(fUseKF);
+      candidate=GetPairCandidate();
     }
   }
-  //delete the surplus candidate
-  delete candidate;
+  AliDielectronVarManager::ClearCache();
+  //keep the surplus candidate for the next pairing
+  fPairPool.Add(candidate);
+}
+
+//________________________________________________________________
+AliDielectronPair* AliDielectron::GetPairCandidate()
+{
+  //
+  // Pair candidate from the pool of pairs recycled by ClearArrays, a new one if the pool is empty
+  //
+  AliDielectronPair *pair=0x0;
+  if (fPairPool.GetEntriesFast()>0) pair=static_cast<AliDielectronPair*>(fPairPool.RemoveAt(fPairPool.GetEntriesFast()-1));
+  if (!pair) pair=new AliDielectronPair;
+  pair->SetKFUsage(fUseKF);
+  return pair;
 }
 
 //________________________________________________________________
@@ -1486,6 +1528,7 @@ void AliDielectron::FillPairArrayTR()
     candidate.SetTracks(&fTrackRotator->GetKFTrackP(), &fTrackRotator->GetKFTrackN(),
                         fTrackRotator->GetVTrackP(),fTrackRotator->GetVTrackN());
     candidate.SetType(kEv1PMRot);
+    AliDielectronVarManager::CacheObject(&candidate);
 
     //pair cuts
     UInt_t cutMask=fPairFilter.IsSelected(&candidate);
@@ -1502,6 +1545,7 @@ void AliDielectron::FillPairArrayTR()
       if(fHistos) FillHistogramsPair(&candidate);
       if(fStoreRotatedPairs) PairArray(kEv1PMRot)->Add(new AliDielectronPair(candidate));
     }
+    AliDielectronVarManager::ClearCache();
   }
 }
 
@@ -2144,8 +2188,9 @@ void AliDielectron::FillHistogramsFromPairArray(Bool_t pairInfoOnly/*=kFALSE*/)
 
   //Fill event information
   if(!pairInfoOnly) {
-    if(fHistos->GetHistogramList()->FindObject("Event")) {
-      fHistos->FillClass("Event", AliDielectronVarManager::kNMaxValues, AliDielectronVarManager::GetData());
+    const Int_t evClass=fHistos->GetClassIndex("Event");
+    if(evClass>=0) {
+      fHistos->FillClass(evClass, AliDielectronVarManager::kNMaxValues, AliDielectronVarManager::GetData());
     }
   }
 
@@ -2159,8 +2204,8 @@ void AliDielectron::FillHistogramsFromPairArray(Bool_t pairInfoOnly/*=kFALSE*/)
 
     className.Form("Pair_%s",fgkPairClassNames[i]);
     className2.Form("Track_Legs_%s",fgkPairClassNames[i]);
-    Bool_t pairClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-    Bool_t legClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
+    const Int_t pairClass=fHistos->GetClassIndex(className.Data());
+    const Int_t legClass=fHistos->GetClassIndex(className2.Data());
 
     //    if (!pairClass&&!legClass) continue;
     for (Int_t ipair=0; ipair<npairs; ++ipair){
@@ -2188,28 +2233,28 @@ void AliDielectron::FillHistogramsFromPairArray(Bool_t pairInfoOnly/*=kFALSE*/)
       AliDielectronVarManager::SetFillMap(fUsedVars);
 
       //fill pair information
-      if (pairClass){
+      if (pairClass>=0){
         AliDielectronVarManager::Fill(pair, values);
-        fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+        fHistos->FillClass(pairClass, AliDielectronVarManager::kNMaxValues, values);
       }
 
       //fill leg information, don't fill the information twice
-      if (legClass){
+      if (legClass>=0){
         AliVParticle *d1=pair->GetFirstDaughterP();
         AliVParticle *d2=pair->GetSecondDaughterP();
         if (!arrLegs.FindObject(d1)){
           AliDielectronVarManager::Fill(d1, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
           arrLegs.Add(d1);
         }
         if (!arrLegs.FindObject(d2)){
           AliDielectronVarManager::Fill(d2, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legClass, AliDielectronVarManager::kNMaxValues, values);
           arrLegs.Add(d2);
         }
       }
     }
-    if (legClass) arrLegs.Clear();
+    if (legClass>=0) arrLegs.Clear();
   }
 
 }
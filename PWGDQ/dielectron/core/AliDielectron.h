@@ -244,6 +244,7 @@ private:
 
   TObjArray *fPairCandidates;     //! Pair candidate arrays
                                   //TODO: better way to store it? TClonesArray?
+  TObjArray fPairPool;            //! Pair candidates recycled from the previous events
 
   AliDielectronCF *fCfManagerPair;//Correction Framework Manager for the Pair
   AliDielectronTrackRotator *fTrackRotator; //Track rotator
@@ -286,6 +287,7 @@ private:
   void ClearArrays();
 
   TObjArray* PairArray(Int_t i);
+  AliDielectronPair* GetPairCandidate();
   TObject* InitEffMap(TString filename, TString generatedname, TString foundname);
 
   static const char* fgkTrackClassNames[4];   //Names for track arrays
@@ -312,7 +314,7 @@ private:
   AliDielectron(const AliDielectron &c);
   AliDielectron &operator=(const AliDielectron &c);
 
-  ClassDef(AliDielectron,17);
+  ClassDef(AliDielectron,18);
 };
 
 inline void AliDielectron::InitPairCandidateArrays()
@@ -344,9 +346,19 @@ inline void AliDielectron::ClearArrays()
   for (Int_t i=0;i<4;++i){
     fTracks[i].Clear();
   }
+  // the pair candidates are kept for the next event
   for (Int_t i=0;i<11;++i){
-    if (PairArray(i)) PairArray(i)->Delete();
+    TObjArray *arr=PairArray(i);
+    if (!arr) continue;
+    Int_t npairs=arr->GetEntriesFast();
+    for (Int_t ipair=0; ipair<npairs; ++ipair){
+      if (arr->UncheckedAt(ipair)) fPairPool.Add(arr->UncheckedAt(ipair));
+    }
+    arr->SetOwner(kFALSE);
+    arr->Clear();
+    arr->SetOwner(kTRUE);
   }
 }
 
+
 #endif
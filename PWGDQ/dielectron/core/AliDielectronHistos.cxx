@@ -61,7 +61,16 @@ AliDielectronHistos::AliDielectronHistos() :
   fHistoList(),
   fList(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
-  fReservedWords(new TString)
+  fReservedWords(new TString),
+  fFillTableOk(kFALSE),
+  fFillClassTable(),
+  fFillClassSize(),
+  fFillClassStart(),
+  fFillHist(),
+  fFillMode(),
+  fFillVars(),
+  fFillAxisVars(),
+  fFillTHnValues()
 {
   //
   // Default constructor
@@ -77,7 +86,16 @@ AliDielectronHistos::AliDielectronHistos(const char* name, const char* title) :
   fHistoList(),
   fList(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
-  fReservedWords(new TString)
+  fReservedWords(new TString),
+  fFillTableOk(kFALSE),
+  fFillClassTable(),
+  fFillClassSize(),
+  fFillClassStart(),
+  fFillHist(),
+  fFillMode(),
+  fFillVars(),
+  fFillAxisVars(),
+  fFillTHnValues()
 {
   //
   // TNamed constructor
@@ -713,11 +731,143 @@ void AliDielectronHistos::FillClass(const char* histClass, Int_t nValues, const
     return;
   }
 
-  TIter nextHist(classTable);
-  TObject *obj=0;
-  while ( (obj=(TObject*)nextHist()) )  FillValues(obj, values);
+  FillClass(GetClassIndex(classTable), nValues, values);
+}
 
-  return;
+//_____________________________________________________________________________
+void AliDielectronHistos::FillClass(Int_t classIndex, Int_t /*nValues*/, const Double_t *values)
+{
+  //
+  // Fill class by the index returned by GetClassIndex
+  //
+  if (classIndex<0) return;
+  if (!fFillTableOk || classIndex>=(Int_t)fFillClassTable.size() ||
+      static_cast<THashList*>(fFillClassTable[classIndex])->GetSize()!=fFillClassSize[classIndex]) BuildFillTable();
+  if (classIndex>=(Int_t)fFillClassTable.size()) return;
+
+  for (Int_t ientry=fFillClassStart[classIndex]; ientry<fFillClassStart[classIndex+1]; ++ientry){
+    TObject *obj=fFillHist[ientry];
+    const UInt_t *var=&fFillVars[4*ientry];
+    switch (fFillMode[ientry]) {
+    case kFillH1:    static_cast<TH1*>(obj)->Fill(values[var[0]]); break;
+    case kFillH1W:   static_cast<TH1*>(obj)->Fill(values[var[0]], values[var[3]]); break;
+    case kFillPrf1:  static_cast<TProfile*>(obj)->Fill(values[var[0]], values[var[1]]); break;
+    case kFillPrf1W: static_cast<TProfile*>(obj)->Fill(values[var[0]], values[var[1]], values[var[3]]); break;
+    case kFillH2:    static_cast<TH1*>(obj)->Fill(values[var[0]], values[var[1]]); break;
+    case kFillH2W:   static_cast<TH2*>(obj)->Fill(values[var[0]], values[var[1]], values[var[3]]); break;
+    case kFillPrf2:  static_cast<TProfile2D*>(obj)->Fill(values[var[0]], values[var[1]], values[var[2]]); break;
+    case kFillPrf2W: static_cast<TProfile2D*>(obj)->Fill(values[var[0]], values[var[1]], values[var[2]], values[var[3]]); break;
+    case kFillH3:    static_cast<TH3*>(obj)->Fill(values[var[0]], values[var[1]], values[var[2]]); break;
+    case kFillH3W:   static_cast<TH3*>(obj)->Fill(values[var[0]], values[var[1]], values[var[2]], values[var[3]]); break;
+    case kFillPrf3:  static_cast<TProfile3D*>(obj)->Fill(values[var[0]], values[var[1]], values[var[2]], values[var[3]]); break;
+    case kFillTHn:
+    case kFillTHnW:
+      for (UInt_t iaxis=0; iaxis<var[1]; ++iaxis) fFillTHnValues[iaxis]=values[fFillAxisVars[var[0]+iaxis]];
+      if (fFillMode[ientry]==kFillTHn) static_cast<THnBase*>(obj)->Fill(&fFillTHnValues[0]);
+      else                             static_cast<THnBase*>(obj)->Fill(&fFillTHnValues[0], values[var[3]]);
+      break;
+    default:         FillValues(obj, values);
+    }
+  }
+}
+
+//_____________________________________________________________________________
+Int_t AliDielectronHistos::GetClassIndex(const char* histClass)
+{
+  //
+  // Index of class 'histClass' to be used in FillClass, -1 if the class is not defined
+  //
+  THashList *classTable=(THashList*)fHistoList.FindObject(histClass);
+  if (!classTable) return -1;
+  return GetClassIndex(classTable);
+}
+
+//_____________________________________________________________________________
+Int_t AliDielectronHistos::GetClassIndex(const TObject *classTable)
+{
+  //
+  // Index of a class table, stored in its unique ID (+1) by BuildFillTable
+  //
+  Int_t classIndex=(Int_t)classTable->GetUniqueID()-1;
+  if (!fFillTableOk || classIndex<0 || classIndex>=(Int_t)fFillClassTable.size() || fFillClassTable[classIndex]!=classTable) {
+    BuildFillTable();
+    classIndex=(Int_t)classTable->GetUniqueID()-1;
+  }
+  return classIndex;
+}
+
+//_____________________________________________________________________________
+void AliDielectronHistos::BuildFillTable()
+{
+  //
+  // Resolve the fill mode and the variables of all histograms, following FillValues.
+  // Histograms which are not filled automatically are left out, the special cases
+  // (trigger map variables, weighted TProfile3D) are filled with FillValues.
+  //
+  fFillClassTable.clear();
+  fFillClassSize.clear();
+  fFillClassStart.clear();
+  fFillHist.clear();
+  fFillMode.clear();
+  fFillVars.clear();
+  fFillAxisVars.clear();
+  fFillTHnValues.clear();
+
+  TIter nextClass(&fHistoList);
+  THashList *classTable=0;
+  while ( (classTable=static_cast<THashList*>(nextClass())) ){
+    classTable->SetUniqueID(fFillClassTable.size()+1);
+    fFillClassTable.push_back(classTable);
+    fFillClassSize.push_back(classTable->GetSize());
+    fFillClassStart.push_back(fFillHist.size());
+
+    TIter nextHist(classTable);
+    TObject *obj=0;
+    while ( (obj=nextHist()) ){
+      const UInt_t valueTypes=obj->GetUniqueID();
+      if (valueTypes==(UInt_t)AliDielectronHistos::kNoAutoFill) continue;
+      Bool_t weight=(valueTypes!=kNoWeights);
+      Int_t mode=kFillGeneric;
+      UInt_t var[4]={0,0,0,valueTypes};
+
+      if (obj->InheritsFrom(TH1::Class())) {
+        TH1 *h=static_cast<TH1*>(obj);
+        Bool_t bprf=(h->IsA()==TProfile::Class() || h->IsA()==TProfile2D::Class() || h->IsA()==TProfile3D::Class());
+        if (h->IsA()==TProfile3D::Class()) weight=kFALSE;
+        var[0]=h->GetXaxis()->GetUniqueID();
+        var[1]=h->GetYaxis()->GetUniqueID();
+        var[2]=h->GetZaxis()->GetUniqueID();
+        Bool_t trigger=kFALSE;
+        for (Int_t ivar=0; ivar<4; ++ivar) {
+          if (var[ivar]==AliDielectronVarManager::kTriggerInclONL || var[ivar]==AliDielectronVarManager::kTriggerInclOFF) trigger=kTRUE;
+        }
+        if (!trigger) {
+          switch (h->GetDimension()) {
+          case 1:  mode = bprf ? (weight ? kFillPrf1W : kFillPrf1) : (weight ? kFillH1W : kFillH1); break;
+          case 2:  mode = bprf ? (weight ? kFillPrf2W : kFillPrf2) : (weight ? kFillH2W : kFillH2); break;
+          case 3:  mode = bprf ? (weight ? kFillGeneric : kFillPrf3) : (weight ? kFillH3W : kFillH3); break;
+          default: continue;
+          }
+        }
+      }
+      else if (obj->InheritsFrom(THnBase::Class())) {
+        THnBase *h=static_cast<THnBase*>(obj);
+        const Int_t dim=h->GetNdimensions();
+        mode = weight ? kFillTHnW : kFillTHn;
+        var[0]=fFillAxisVars.size();
+        var[1]=dim;
+        for (Int_t iaxis=0; iaxis<dim; ++iaxis) fFillAxisVars.push_back(h->GetAxis(iaxis)->GetUniqueID());
+        if ((Int_t)fFillTHnValues.size()<dim) fFillTHnValues.resize(dim);
+      }
+      else continue;
+
+      fFillHist.push_back(obj);
+      fFillMode.push_back(mode);
+      for (Int_t ivar=0; ivar<4; ++ivar) fFillVars.push_back(var[ivar]);
+    }
+  }
+  fFillClassStart.push_back(fFillHist.size());
+  fFillTableOk=kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -14,6 +14,8 @@
 //                                                                                       //
 ///////////////////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
 #include <Rtypes.h>
 
 #include <TNamed.h>
@@ -145,6 +147,8 @@ public:
   
 //   void FillClass(const char* histClass, const TVectorD &vals);
   void FillClass(const char* histClass, Int_t nValues, const Double_t *values);
+  void FillClass(Int_t classIndex, Int_t nValues, const Double_t *values);
+  Int_t GetClassIndex(const char* histClass);
   
   TObject* GetHist(const char* histClass, const char* name) const;
   TH1* GetHistogram(const char* histClass, const char* name) const;
@@ -152,7 +156,7 @@ public:
   TH1* GetHistogram(const char* cutClass, const char* histClass, const char* name) const;
 
   void SetHistogramList(THashList &list, Bool_t setOwner=kTRUE);
-  void ResetHistogramList(){fHistoList.Clear();}
+  void ResetHistogramList(){fHistoList.Clear(); fFillTableOk=kFALSE;}
   const THashList* GetHistogramList() const {return &fHistoList;}
 
   void SetList(TList * const list) { fList=list; }
@@ -191,11 +195,29 @@ private:
 
   void FillVarArray(TObject *obj, UInt_t *valType);
 
+  // fill modes of the histograms in the fill table
+  enum EFillMode { kFillGeneric=0, kFillH1, kFillH1W, kFillPrf1, kFillPrf1W, kFillH2, kFillH2W,
+                   kFillPrf2, kFillPrf2W, kFillH3, kFillH3W, kFillPrf3, kFillTHn, kFillTHnW };
+
+  void BuildFillTable();
+  Int_t GetClassIndex(const TObject *classTable);
+
   THashList fHistoList;             //-> list of histograms
   TList    *fList;                  //! List of list of histograms
 	TBits     *fUsedVars;            // list of used variables
 
   TString *fReservedWords;          //! list of reserved words
+
+  // fill table: the histograms of each class with their fill mode and variables, built from fHistoList
+  Bool_t                 fFillTableOk;       //! fill table up to date
+  std::vector<TObject*>  fFillClassTable;    //! class table of each class index
+  std::vector<Int_t>     fFillClassSize;     //! number of histograms of each class when the table was built
+  std::vector<Int_t>     fFillClassStart;    //! first fill entry of each class (size: classes+1)
+  std::vector<TObject*>  fFillHist;          //! histogram of each fill entry
+  std::vector<Int_t>     fFillMode;          //! EFillMode of each fill entry
+  std::vector<UInt_t>    fFillVars;          //! x, y, z and profile/weight variable of each fill entry
+  std::vector<UInt_t>    fFillAxisVars;      //! axis variables of the THn entries
+  std::vector<Double_t>  fFillTHnValues;     //! THn fill buffer
   void UserHistogramReservedWords(const char* histClass, const TObject *hist, UInt_t valTypes);
   void FillClass(THashTable *classTable, Int_t nValues, Double_t *values);
   
@@ -208,7 +230,7 @@ private:
   AliDielectronHistos(const AliDielectronHistos &hist);
   AliDielectronHistos& operator = (const AliDielectronHistos &hist);
 
-  ClassDef(AliDielectronHistos,3)
+  ClassDef(AliDielectronHistos,4)
 };
 
 #endif
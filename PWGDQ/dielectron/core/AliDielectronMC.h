@@ -113,6 +113,7 @@ public:
   Bool_t GetPrimaryVertex(Double_t &primVtxX, Double_t &primVtxY, Double_t &primVtxZ);
 
   AliMCEvent* GetMCEvent() { return fMCEvent; }         // return the AliMCEvent
+  Bool_t HasMCEvent() const { return (fAnaType==kESD && fMCEvent) || (fAnaType==kAOD && fMcArray); } // MC truth connected for this event
 
 private:
   AliMCEvent    *fMCEvent;  // MC event object
@@ -22,6 +22,8 @@
 //                                                                       //
 ///////////////////////////////////////////////////////////////////////////
 
+#include <cstring>
+
 #include "AliDielectronVarManager.h"
 
 ClassImp(AliDielectronVarManager)
@@ -671,6 +673,74 @@ Bool_t          AliDielectronVarManager::fgEventPlaneACremoval = kFALSE;
 TString         AliDielectronVarManager::fgQnVectorNorm = "";
 Int_t           AliDielectronVarManager::fgCurrentRun = -1;
 Double_t        AliDielectronVarManager::fgData[AliDielectronVarManager::kNMaxValues] = {0.};
+const TObject*  AliDielectronVarManager::fgCacheObject      = 0x0;
+Bool_t          AliDielectronVarManager::fgCacheFilled      = kFALSE;
+Bool_t          AliDielectronVarManager::fgCacheAllVars[2]  = {kFALSE,kFALSE};
+TBits           AliDielectronVarManager::fgCacheMap[2];
+Int_t           AliDielectronVarManager::fgCacheNFilled     = 0;
+Int_t           AliDielectronVarManager::fgCacheFilledVars[AliDielectronVarManager::kNMaxValues] = {0};
+Double_t        AliDielectronVarManager::fgCacheValues[AliDielectronVarManager::kNMaxValues] = {0.};
+
+// bit pattern (a NaN) marking the cache entries not written by a fill
+static const ULong64_t kCacheUnsetPattern = 0x7ff4dead7ff4deadULL;
+//________________________________________________________________
+void AliDielectronVarManager::CacheObject(const TObject* object)
+{
+  //
+  // Compute the variables of this object (track or pair) only once for all the
+  // following Fill() calls with it (cuts, histograms, CF, cut QA), until the
+  // next call or ClearCache(). The object must not change in the meantime.
+  //
+  fgCacheObject = object;
+  fgCacheFilled = kFALSE;
+}
+
+//________________________________________________________________
+void AliDielectronVarManager::FillFromCache(Double_t * const values)
+{
+  //
+  // Copy the cached values of fgCacheObject. The cache is filled with the union
+  // of the fill maps requested so far for this type of object, which is kept
+  // for the next objects, so that after the first candidates each object is
+  // filled once per event loop step.
+  //
+  const Int_t slot = (fgCacheObject->IsA()==AliDielectronPair::Class()) ? 1 : 0;
+
+  Bool_t refill = !fgCacheFilled;
+  if (!fgCacheAllVars[slot]) {
+    if (!fgFillMap) {
+      fgCacheAllVars[slot] = kTRUE;
+      refill = kTRUE;
+    } else {
+      for (UInt_t ivar=fgFillMap->FirstSetBit(); ivar<fgFillMap->GetNbits(); ivar=fgFillMap->FirstSetBit(ivar+1)) {
+        if (fgCacheMap[slot].TestBitNumber(ivar)) continue;
+        fgCacheMap[slot].SetBitNumber(ivar);
+        refill = kTRUE;
+      }
+    }
+  }
+
+  if (refill) {
+    TBits *fillMap = fgFillMap;
+    fgFillMap = fgCacheAllVars[slot] ? 0x0 : &fgCacheMap[slot];
+    for (Int_t i=0; i<kNMaxValues; ++i) memcpy(&fgCacheValues[i], &kCacheUnsetPattern, sizeof(Double_t));
+    const TObject *object = fgCacheObject;
+    fgCacheObject = 0x0; // nested Fill() calls for the same object are not cached
+    FillObject(object, fgCacheValues);
+    fgCacheObject = object;
+    fgFillMap = fillMap;
+
+    fgCacheNFilled = 0;
+    for (Int_t i=0; i<kNMaxValues; ++i) {
+      if (memcmp(&fgCacheValues[i], &kCacheUnsetPattern, sizeof(Double_t))==0) continue;
+      fgCacheFilledVars[fgCacheNFilled++] = i;
+    }
+    fgCacheFilled = kTRUE;
+  }
+
+  for (Int_t i=0; i<fgCacheNFilled; ++i) values[fgCacheFilledVars[i]] = fgCacheValues[fgCacheFilledVars[i]];
+}
+
 //________________________________________________________________
 AliDielectronVarManager::AliDielectronVarManager() :
   TNamed("AliDielectronVarManager","AliDielectronVarManager")
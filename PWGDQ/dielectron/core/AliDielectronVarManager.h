@@ -688,6 +688,8 @@ public:
   AliDielectronVarManager(const char* name, const char* title);
   virtual ~AliDielectronVarManager();
   static void Fill(const TObject* particle, Double_t * const values);
+  static void CacheObject(const TObject* object);
+  static void ClearCache() { fgCacheObject=0x0; fgCacheFilled=kFALSE; }
   static void FillVarMCParticle2(const AliVParticle *p1, const AliVParticle *p2, Double_t * const values);
   static void FillVarVParticle(const AliVParticle *particle,         Double_t * const values);
 
@@ -737,6 +739,8 @@ private:
   static const char* fgkParticleNames[kNMaxValues][3];  //variable names
 
   static Bool_t Req(ValueTypes var) { return (fgFillMap ? fgFillMap->TestBitNumber(var) : kTRUE); }
+  static void FillObject(const TObject* object, Double_t * const values);
+  static void FillFromCache(Double_t * const values);
   static void FillVarESDtrack(const AliESDtrack *particle,           Double_t * const values);
   static void FillVarAODTrack(const AliAODTrack *particle,           Double_t * const values);
   static void FillVarVTrdTrack(const AliVParticle *particle,         Double_t * const values);
@@ -785,6 +789,15 @@ private:
 
   static Double_t fgData[kNMaxValues];        //! data
 
+  // values of the object set with CacheObject(), shared by all Fill() calls for it
+  static const TObject *fgCacheObject;                 //! object whose values are cached
+  static Bool_t    fgCacheFilled;                      //! cache filled for fgCacheObject
+  static Bool_t    fgCacheAllVars[2];                  //! all variables requested (tracks, pairs)
+  static TBits     fgCacheMap[2];                      //! union of the requested variables (tracks, pairs)
+  static Int_t     fgCacheNFilled;                     //! number of entries written by the last fill
+  static Int_t     fgCacheFilledVars[kNMaxValues];     //! entries written by the last fill
+  static Double_t  fgCacheValues[kNMaxValues];         //! cached values
+
   AliDielectronVarManager(const AliDielectronVarManager &c);
   AliDielectronVarManager &operator=(const AliDielectronVarManager &c);
 
@@ -797,8 +810,21 @@ inline void AliDielectronVarManager::Fill(const TObject* object, Double_t * cons
 {
   //
   // Main function to fill all available variables according to the type of particle
+  // The variables of the object set with CacheObject() are computed only once
   //
   if (!object) return;
+  if (object==fgCacheObject) {
+    FillFromCache(values);
+    return;
+  }
+  FillObject(object, values);
+}
+
+inline void AliDielectronVarManager::FillObject(const TObject* object, Double_t * const values)
+{
+  //
+  // Fill all available variables according to the type of particle or event
+  //
   if      (object->IsA() == AliESDtrack::Class())       FillVarESDtrack(static_cast<const AliESDtrack*>(object), values);
   else if (object->IsA() == AliAODTrack::Class())       FillVarAODTrack(static_cast<const AliAODTrack*>(object), values);
   else if (object->IsA() == AliMCParticle::Class())     FillVarMCParticle(static_cast<const AliMCParticle*>(object), values);
@@ -3338,6 +3364,7 @@ inline Double_t AliDielectronVarManager::GetTRDpidEfficiency(Int_t runNo, Double
 
 inline void AliDielectronVarManager::SetEvent(AliVEvent * const ev)
 {
+  ClearCache();
   fgEvent = ev;
   if (fgKFVertex) delete fgKFVertex;
   fgKFVertex=0x0;
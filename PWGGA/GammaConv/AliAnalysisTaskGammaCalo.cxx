@@ -3116,6 +3116,10 @@ void AliAnalysisTaskGammaCalo::ProcessMCParticles()
 //________________________________________________________________________
 void AliAnalysisTaskGammaCalo::CalculatePi0Candidates(){
 
+  // The pairs are not shared between cuts as in AliAnalysisTaskGammaConvV1: the cluster
+  // photons are built for each cut by ProcessClusters from its own cluster copies, with
+  // the non linearity correction of the cut applied to the cluster energy
+
   // Conversion Gammas
   if(fClusterCandidates->GetEntries()>0){
 
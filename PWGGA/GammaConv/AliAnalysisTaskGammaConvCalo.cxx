@@ -3959,6 +3959,10 @@ void AliAnalysisTaskGammaConvCalo::ProcessMCParticles()
 //________________________________________________________________________
 void AliAnalysisTaskGammaConvCalo::CalculatePi0Candidates(){
 
+  // The pairs are not shared between cuts as in AliAnalysisTaskGammaConvV1: every pair
+  // contains a cluster photon, which ProcessClusters builds for each cut from its own
+  // cluster copy (non linearity correction of the cut applied to the cluster energy)
+
   // Conversion Gammas
   if(fGammaCandidates->GetEntries()>0){
     for(Int_t firstGammaIndex=0;firstGammaIndex<fGammaCandidates->GetEntries();firstGammaIndex++){
@@ -264,7 +264,10 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(): AliAnalysisTaskSE(),
   fEnableClusterCutsForTrigger(kFALSE),
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
   tBrokenFiles(NULL),
-  fFileNameBroken(NULL)
+  fFileNameBroken(NULL),
+  fShareSameEventPairs(kTRUE),
+  fGammaCandidatesReaderIndex(),
+  fSharedPairs()
 {
 
 }
@@ -474,7 +477,10 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
   fEnableClusterCutsForTrigger(kFALSE),
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
   tBrokenFiles(NULL),
-  fFileNameBroken(NULL)
+  fFileNameBroken(NULL),
+  fShareSameEventPairs(kTRUE),
+  fGammaCandidatesReaderIndex(),
+  fSharedPairs()
 {
   // Define output slots here
   DefineOutput(1, TList::Class());
@@ -499,7 +505,7 @@ AliAnalysisTaskGammaConvV1::~AliAnalysisTaskGammaConvV1()
     delete[] fWeightCentrality; 
     fWeightCentrality = 0x0; 
   }
-    
+  ResetSharedPairs(0);
 }
 //___________________________________________________________
 void AliAnalysisTaskGammaConvV1::InitBack(){
@@ -575,6 +581,7 @@ void AliAnalysisTaskGammaConvV1::InitBack(){
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->GetNumberOfBGEvents(),
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseTrackMultiplicity(),
                                   0,8,5);
+        fBGHandler[iCut]->SetUseCompactPool(kTRUE); // see CalculateBackgroundCompact
         fBGHandlerRP[iCut] = NULL;
       } else {
         fBGHandlerRP[iCut] = new AliConversionAODBGHandlerRP(
@@ -1678,6 +1685,19 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
     RelabelAODPhotonCandidates(kTRUE);    // In case of AODMC relabeling MC
     fV0Reader->RelabelAODs(kTRUE);
   }
+  // Same event gamma pairs are built once for all cuts (see GetSharedPair).
+  // In MC the smearing of one cut changes the reader gammas in place until
+  // they are restored, so the pairs are not shared if any cut smears.
+  Bool_t shareSameEventPairs = fShareSameEventPairs && fDoMesonAnalysis && fnCuts > 1;
+  if(shareSameEventPairs && fIsMC > 0){
+    for(Int_t iCut = 0; iCut<fnCuts; iCut++){
+      if(((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseMCPSmearing()){
+        shareSameEventPairs = kFALSE;
+        break;
+      }
+    }
+  }
+  ResetSharedPairs(shareSameEventPairs ? fReaderGammas->GetEntriesFast() : 0);
   for(Int_t iCut = 0; iCut<fnCuts; iCut++){
     fiCut = iCut;
     
@@ -1861,6 +1881,7 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
 
     fGammaCandidates->Clear(); // delete this cuts good gammas
   }
+  ResetSharedPairs(0);
 
   if( fIsMC > 0 && fInputEvent->IsA()==AliAODEvent::Class() && !(fV0Reader->AreAODsRelabeled())){
     RelabelAODPhotonCandidates(kFALSE); // Back to ESDMC Label
@@ -2892,6 +2913,19 @@ void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
 
   // Conversion Gammas
   if(fGammaCandidates->GetEntries()>1){
+    // Reader indices of this cuts gammas, to take the pairs from the shared table.
+    // The table is empty if pairs are not shared in this event (see UserExec).
+    fGammaCandidatesReaderIndex.clear();
+    if(!fSharedPairs.empty()){
+      Int_t readerIndex = 0;
+      TIter nextGamma(fGammaCandidates);
+      TObject *gamma = 0x0;
+      while((gamma = nextGamma())){
+        while(readerIndex < fReaderGammas->GetEntriesFast() && fReaderGammas->At(readerIndex) != gamma) readerIndex++;
+        if(readerIndex == fReaderGammas->GetEntriesFast()) break; // not in the reader order, not shared from here on
+        fGammaCandidatesReaderIndex.push_back(readerIndex++);
+      }
+    }
     for(Int_t firstGammaIndex=0;firstGammaIndex<fGammaCandidates->GetEntries()-1;firstGammaIndex++){
       AliAODConversionPhoton *gamma0=dynamic_cast<AliAODConversionPhoton*>(fGammaCandidates->At(firstGammaIndex));
       if (gamma0==NULL) continue;
@@ -2904,9 +2938,13 @@ void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
         gamma0->GetTrackLabelNegative() == gamma1->GetTrackLabelPositive() ||
         gamma0->GetTrackLabelPositive() == gamma1->GetTrackLabelNegative() ) continue;
 
-        AliAODConversionMother *pi0cand = new AliAODConversionMother(gamma0,gamma1);
+        AliAODConversionMother *pi0cand = GetSharedPair(firstGammaIndex,secondGammaIndex);
+        Bool_t isSharedPair = (pi0cand != 0x0);
+        if(!isSharedPair){
+          pi0cand = new AliAODConversionMother(gamma0,gamma1);
+          pi0cand->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+        }
         pi0cand->SetLabels(firstGammaIndex,secondGammaIndex);
-        pi0cand->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
         
         if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->MesonIsSelected(pi0cand,kTRUE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
           if(fDoCentralityFlat > 0){
@@ -3004,13 +3042,37 @@ void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
             }   
           }
         }
-        delete pi0cand;
+        if(!isSharedPair) delete pi0cand;
         pi0cand=0x0;
       }
     }
   }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::ResetSharedPairs(Int_t nGammas){
+  // Delete the shared same event pairs and prepare the table for
+  // nGammas reader gammas (0: pairs are not shared)
+  for(UInt_t i = 0; i < fSharedPairs.size(); i++) delete fSharedPairs[i];
+  fSharedPairs.assign(nGammas > 1 ? nGammas*(nGammas-1)/2 : 0, (AliAODConversionMother*)0x0);
+}
+
+//________________________________________________________________________
+AliAODConversionMother* AliAnalysisTaskGammaConvV1::GetSharedPair(Int_t firstGammaIndex, Int_t secondGammaIndex){
+  // Pair of the gamma candidates firstGammaIndex < secondGammaIndex of the current cut,
+  // built by the first cut which needs it in this event. The pair only depends on the
+  // two reader gammas and the primary vertex. NULL if it cannot be shared.
+  if(secondGammaIndex >= (Int_t)fGammaCandidatesReaderIndex.size()) return 0x0;
+  Int_t readerIndex0 = fGammaCandidatesReaderIndex[firstGammaIndex];
+  Int_t readerIndex1 = fGammaCandidatesReaderIndex[secondGammaIndex];
+  AliAODConversionMother *&pair = fSharedPairs[readerIndex1*(readerIndex1-1)/2 + readerIndex0];
+  if(!pair){
+    pair = new AliAODConversionMother((AliAODConversionPhoton*)fReaderGammas->At(readerIndex0),(AliAODConversionPhoton*)fReaderGammas->At(readerIndex1));
+    pair->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+  }
+  return pair;
+}
+
 //______________________________________________________________________
 void AliAnalysisTaskGammaConvV1::ProcessTrueMesonCandidates(AliAODConversionMother *Pi0Candidate, AliAODConversionPhoton *TrueGammaCandidate0, AliAODConversionPhoton *TrueGammaCandidate1)
 {
@@ -3477,6 +3539,8 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
         }
       }
     }
+  } else if(fBGHandler[fiCut]->GetUseCompactPool()){
+    CalculateBackgroundCompact(zbin,mbin);
   } else {
     AliGammaConversionAODBGHandler::GammaConversionVertex *bgEventVertex = NULL;
 
@@ -3557,6 +3621,51 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
     }
   }
 }
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvV1::CalculateBackgroundCompact(Int_t zbin, Int_t mbin){
+  // Mixed event background from the compact photon pools of the background handler.
+  // Each stored photon is unpacked into one reused photon, instead of copying full
+  // photon objects for every pair; the current gammas are used as they are.
+  AliGammaConversionAODBGHandler::GammaConversionVertex *bgEventVertex = NULL;
+  AliAODConversionPhoton previousGoodV0;
+  vector<AliAODConversionPhoton*> currentEventGoodV0s;
+  TIter nextGamma(fGammaCandidates);
+  while(AliAODConversionPhoton *gamma = (AliAODConversionPhoton*)nextGamma()) currentEventGoodV0s.push_back(gamma);
+
+  for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
+    const AliGammaConversionAODBGHandler::AliGammaConversionCompactVector *previousEventV0s = fBGHandler[fiCut]->GetBGCompactV0s(zbin,mbin,nEventsInBG);
+    if(previousEventV0s->empty()) continue;
+    if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
+      bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
+    }
+    for(UInt_t iCurrent=0;iCurrent<currentEventGoodV0s.size();iCurrent++){
+      AliAODConversionPhoton *currentEventGoodV0 = currentEventGoodV0s[iCurrent];
+      for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+        AliGammaConversionAODBGHandler::FillPhoton((*previousEventV0s)[iPrevious],&previousGoodV0);
+        if(fMoveParticleAccordingToVertex == kTRUE){
+          MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
+        }
+        if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
+          RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
+        }
+
+        AliAODConversionMother backgroundCandidate(currentEventGoodV0,&previousGoodV0);
+        backgroundCandidate.CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+        if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))
+          ->MesonIsSelected(&backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
+          if(fDoCentralityFlat > 0) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(), fWeightCentrality[fiCut]*fWeightJetJetMC);
+          else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate.M(),backgroundCandidate.Pt(),fWeightJetJetMC);
+          if(fDoTHnSparse){
+            Double_t sparesFill[4] = {backgroundCandidate.M(),backgroundCandidate.Pt(),(Double_t)zbin,(Double_t)mbin};
+            if(fDoCentralityFlat > 0) sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightCentrality[fiCut]*fWeightJetJetMC); //instead of weight 1
+            else sESDMotherBackInvMassPtZM[fiCut]->Fill(sparesFill, fWeightJetJetMC);
+          }
+        }
+      }
+    }
+  }
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskGammaConvV1::CalculateBackgroundRP(){
 
@@ -46,7 +46,10 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     void ProcessPhotonCandidates();
     void ProcessClusters();
     void CalculatePi0Candidates();
+    void ResetSharedPairs(Int_t nGammas);
+    AliAODConversionMother* GetSharedPair(Int_t firstGammaIndex, Int_t secondGammaIndex);
     void CalculateBackground();
+    void CalculateBackgroundCompact(Int_t zbin, Int_t mbin);
     void CalculateBackgroundRP();
     void ProcessMCParticles();
     void ProcessAODMCParticles();
@@ -68,6 +71,8 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
                                                                   fClusterCutArray              = CutArray  ;}
                                                                   
     void SetDoMaterialBudgetWeightingOfGammasForTrueMesons(Bool_t flag) {fDoMaterialBudgetWeightingOfGammasForTrueMesons = flag;}
+    void SetShareSameEventPairs(Bool_t flag)                      {fShareSameEventPairs = flag;}
+    TList* GetMesonCutList()                                      {return fMesonCutArray;}
     
     // BG HandlerSettings
     void SetMoveParticleAccordingToVertex(Bool_t flag)            {fMoveParticleAccordingToVertex = flag;}
@@ -302,12 +307,15 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     Bool_t                            fDoMaterialBudgetWeightingOfGammasForTrueMesons;
     TTree*                            tBrokenFiles;                               // tree for keeping track of broken files
     TObjString*                       fFileNameBroken;                            // string object for broken file name
+    Bool_t                            fShareSameEventPairs;                       // build the same event gamma pairs once for all cuts
+    vector<Int_t>                     fGammaCandidatesReaderIndex;                //! index in fReaderGammas of the gamma candidates of the current cut
+    vector<AliAODConversionMother*>   fSharedPairs;                               //! same event gamma pairs of this event by reader gamma indices, shared by all cuts
 
   private:
 
     AliAnalysisTaskGammaConvV1(const AliAnalysisTaskGammaConvV1&); // Prevent copy-construction
     AliAnalysisTaskGammaConvV1 &operator=(const AliAnalysisTaskGammaConvV1&); // Prevent assignment
-    ClassDef(AliAnalysisTaskGammaConvV1, 42);
+    ClassDef(AliAnalysisTaskGammaConvV1, 44);
 };
 
 #endif
@@ -130,6 +130,7 @@ class AliConversionMesonCuts : public AliAnalysisCuts {
     TLorentzVector SmearElectron(TLorentzVector particle);
 
     void    SetDefaultSmearing(Double_t p0, Double_t p1, Double_t p2){fUseMCPSmearing=1.;fPBremSmearing=p0;fPSigSmearing=p1;fPSigSmearingCte=p2;return;}
+    void    SetSmearingSeed(UInt_t seed){fRandom.SetSeed(seed);return;}
 
     //Cut functions
     Bool_t RejectSharedElectronV0s(AliAODConversionPhoton* photon, Int_t nV0, Int_t nV0s);
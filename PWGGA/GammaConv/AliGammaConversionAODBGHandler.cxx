@@ -24,6 +24,7 @@
 #include "AliKFParticle.h"
 #include "AliAODConversionPhoton.h"
 #include "AliAODConversionMother.h"
+#include "TList.h"
 
 using namespace std;
 
@@ -45,7 +46,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler() :
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(),
 	fBGEventsENeg(),
-	fBGEventsMeson()
+	fBGEventsMeson(),
+	fUseCompactPool(kFALSE),
+	fBGEventsCompact()
 {
 	// constructor
 }
@@ -66,7 +69,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t binsZ,Int_t
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fUseCompactPool(kFALSE),
+	fBGEventsCompact(binsZ,AliGammaConversionCompactMultipicityVector(binsMultiplicity,AliGammaConversionCompactBGEventVector(nEvents)))
 {
 	// constructor
 }
@@ -89,7 +94,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t collisionSy
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fUseCompactPool(kFALSE),
+	fBGEventsCompact(binsZ,AliGammaConversionCompactMultipicityVector(binsMultiplicity,AliGammaConversionCompactBGEventVector(nEvents)))
 {
 	// constructor
     if(fNBinsZ>8) fNBinsZ = 8;
@@ -361,7 +368,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(const AliGammaCon
 	fBinLimitsArrayMultiplicity(original.fBinLimitsArrayMultiplicity),
 	fBGEvents(original.fBGEvents),
 	fBGEventsENeg(original.fBGEventsENeg),
-	fBGEventsMeson(original.fBGEventsMeson)
+	fBGEventsMeson(original.fBGEventsMeson),
+	fUseCompactPool(original.fUseCompactPool),
+	fBGEventsCompact(original.fBGEventsCompact)
 {
 	//copy constructor	
 }
@@ -597,6 +606,26 @@ void AliGammaConversionAODBGHandler::AddEvent(TList* const eventGammas,Double_t
 		delete (AliAODConversionPhoton*)(fBGEvents[z][m][eventCounter][d]);
 	}
 	fBGEvents[z][m][eventCounter].clear();
+
+	if(fUseCompactPool){
+		// keep what is needed to pair the gammas, the slot keeps its capacity for the next events
+		AliGammaConversionCompactVector &compactEvent = fBGEventsCompact[z][m][eventCounter];
+		compactEvent.resize(eventGammas->GetEntries());
+		TIter nextGamma(eventGammas);
+		for(UInt_t i=0; i<compactEvent.size(); i++){
+			AliAODConversionPhoton *gamma = (AliAODConversionPhoton*)nextGamma();
+			compactEvent[i].fPx = gamma->Px();
+			compactEvent[i].fPy = gamma->Py();
+			compactEvent[i].fPz = gamma->Pz();
+			compactEvent[i].fE  = gamma->E();
+			compactEvent[i].fConversionPoint[0] = gamma->GetConversionX();
+			compactEvent[i].fConversionPoint[1] = gamma->GetConversionY();
+			compactEvent[i].fConversionPoint[2] = gamma->GetConversionZ();
+			compactEvent[i].fQuality = gamma->GetPhotonQuality();
+		}
+		fBGEventCounter[z][m]++;
+		return;
+	}
 	
 	// add the gammas to the vector
 	for(Int_t i=0; i< eventGammas->GetEntries();i++){
@@ -706,6 +735,16 @@ AliGammaConversionAODVector* AliGammaConversionAODBGHandler::GetBGGoodV0s(Int_t
 	return &(fBGEvents[zbin][mbin][event]);
 }
 
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::FillPhoton(const GammaConversionPhoton &compactPhoton, AliAODConversionPhoton *photon){
+	// set momentum, conversion point and quality of photon to the ones of a compact background photon,
+	// all what AliAODConversionMother uses to build a pair
+	photon->SetPxPyPzE(compactPhoton.fPx,compactPhoton.fPy,compactPhoton.fPz,compactPhoton.fE);
+	Double_t conversionPoint[3] = {compactPhoton.fConversionPoint[0],compactPhoton.fConversionPoint[1],compactPhoton.fConversionPoint[2]};
+	photon->SetConversionPoint(conversionPoint);
+	photon->SetPhotonQuality(compactPhoton.fQuality);
+}
+
 //_____________________________________________________________________________________________________________________________
 AliGammaConversionMotherAODVector* AliGammaConversionAODBGHandler::GetBGGoodMesons(Int_t zbin, Int_t mbin, Int_t event){
 	//see headerfile for documentation
@@ -738,6 +777,9 @@ void AliGammaConversionAODBGHandler::PrintBGArray(){
 						if(fBGEvents[z][multiplicity][event].size()>0){
 						cout<<"Event: "<<event<<" has: "<<fBGEvents[z][multiplicity][event].size()<<endl;
 						}
+						if(fUseCompactPool && fBGEventsCompact[z][multiplicity][event].size()>0){
+						cout<<"Event: "<<event<<" has: "<<fBGEventsCompact[z][multiplicity][event].size()<<" (compact)"<<endl;
+						}
 					}
 				}
 			}
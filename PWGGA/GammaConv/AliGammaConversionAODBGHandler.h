@@ -36,10 +36,24 @@ class AliGammaConversionAODBGHandler : public TObject {
 	
 	typedef struct GammaConversionVertex GammaConversionVertex; 																//!
 
+	struct GammaConversionPhoton{																								// compact background photon, see SetUseCompactPool
+		Double_t fPx;
+		Double_t fPy;
+		Double_t fPz;
+		Double_t fE;
+		Double_t fConversionPoint[3];
+		UChar_t fQuality;
+	};
+
 	typedef std::vector<AliGammaConversionAODVector> AliGammaConversionBGEventVector;
 	typedef std::vector<AliGammaConversionBGEventVector> AliGammaConversionMultipicityVector;
 	typedef std::vector<AliGammaConversionMultipicityVector> AliGammaConversionBGVector;
 
+	typedef std::vector<GammaConversionPhoton> AliGammaConversionCompactVector;
+	typedef std::vector<AliGammaConversionCompactVector> AliGammaConversionCompactBGEventVector;
+	typedef std::vector<AliGammaConversionCompactBGEventVector> AliGammaConversionCompactMultipicityVector;
+	typedef std::vector<AliGammaConversionCompactMultipicityVector> AliGammaConversionCompactBGVector;
+
 	typedef std::vector<AliGammaConversionMotherAODVector> AliGammaConversionMotherBGEventVector;
 	typedef std::vector<AliGammaConversionMotherBGEventVector> AliGammaConversionMotherMultipicityVector;
 	typedef std::vector<AliGammaConversionMotherMultipicityVector> AliGammaConversionMotherBGVector;
@@ -69,6 +83,13 @@ class AliGammaConversionAODBGHandler : public TObject {
 
 	// Get BG photons
 	AliGammaConversionAODVector* GetBGGoodV0s(Int_t zbin, Int_t mbin, Int_t event);
+
+	// Compact photon pools: AddEvent only keeps the momentum, conversion point and quality
+	// of the photons, to be read with GetBGCompactV0s instead of GetBGGoodV0s
+	void SetUseCompactPool(Bool_t flag) {fUseCompactPool = flag;}
+	Bool_t GetUseCompactPool() const {return fUseCompactPool;}
+	const AliGammaConversionCompactVector* GetBGCompactV0s(Int_t zbin, Int_t mbin, Int_t event) const {return &(fBGEventsCompact[zbin][mbin][event]);}
+	static void FillPhoton(const GammaConversionPhoton &compactPhoton, AliAODConversionPhoton *photon);
 	
 	// Get BG mesons
 	AliGammaConversionMotherAODVector* GetBGGoodMesons(Int_t zbin, Int_t mbin, Int_t event);
@@ -98,7 +119,9 @@ class AliGammaConversionAODBGHandler : public TObject {
 		AliGammaConversionBGVector 			fBGEvents; 						// photon background events
 		AliGammaConversionBGVector 			fBGEventsENeg; 					// electron background electron events
 		AliGammaConversionMotherBGVector 	fBGEventsMeson; 				// neutral meson background events
+		Bool_t 								fUseCompactPool;				// store the background photons as GammaConversionPhoton
+		AliGammaConversionCompactBGVector 	fBGEventsCompact; 				//! compact photon background events
 		
-	ClassDef(AliGammaConversionAODBGHandler,6)
+	ClassDef(AliGammaConversionAODBGHandler,7)
 };
 #endif
@@ -70,6 +70,11 @@
 #include "AliCodeTimer.h"
 #include "AliMultSelection.h"
 #include <cstring>
+#if __cplusplus >= 201103L
+#include <functional>
+#include <thread>
+#include <vector>
+#endif
 
 /// \cond CLASSIMP
 ClassImp(AliAnalysisVertexingHF);
@@ -138,6 +143,11 @@ fFindVertexForDstar(kTRUE),
 fFindVertexForCascades(kTRUE),
 fV0TypeForCascadeVertex(0),
 fMassCutBeforeVertexing(kFALSE),
+fUsePairPreselection(kTRUE),
+fNWorkerThreads(0),
+fPairDCASize(0),
+fPairDCA(0),
+fPairDCAOrder(0),
 fMassCalc2(0),
 fMassCalc3(0),
 fMassCalc4(0),
@@ -233,6 +243,11 @@ fFindVertexForDstar(source.fFindVertexForDstar),
 fFindVertexForCascades(source.fFindVertexForCascades),
 fV0TypeForCascadeVertex(source.fV0TypeForCascadeVertex),
 fMassCutBeforeVertexing(source.fMassCutBeforeVertexing),
+fUsePairPreselection(source.fUsePairPreselection),
+fNWorkerThreads(source.fNWorkerThreads),
+fPairDCASize(0),
+fPairDCA(0),
+fPairDCAOrder(0),
 fMassCalc2(source.fMassCalc2),
 fMassCalc3(source.fMassCalc3),
 fMassCalc4(source.fMassCalc4),
@@ -327,6 +342,8 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fFindVertexForCascades = source.fFindVertexForCascades;
   fV0TypeForCascadeVertex = source.fV0TypeForCascadeVertex;
   fMassCutBeforeVertexing = source.fMassCutBeforeVertexing;
+  fUsePairPreselection = source.fUsePairPreselection;
+  fNWorkerThreads = source.fNWorkerThreads;
   fMassCalc2 = source.fMassCalc2;
   fMassCalc3 = source.fMassCalc3;
   fMassCalc4 = source.fMassCalc4;
@@ -371,6 +388,8 @@ AliAnalysisVertexingHF::~AliAnalysisVertexingHF() {
   if(fMassCalc2) { delete fMassCalc2; fMassCalc2=0; }
   if(fMassCalc3) { delete fMassCalc3; fMassCalc3=0; }
   if(fMassCalc4) { delete fMassCalc4; fMassCalc4=0; }
+  if(fPairDCA) { delete [] fPairDCA; fPairDCA=0; }
+  if(fPairDCAOrder) { delete [] fPairDCAOrder; fPairDCAOrder=0; }
 }
 //----------------------------------------------------------------------------
 TList *AliAnalysisVertexingHF::FillListOfCuts() {
@@ -618,6 +637,36 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // transverse helix circles of the tracks at the primary vertex, to skip
+  // pairs that cannot pass the DCA cut before calling GetDCA()
+  Double_t *trkCircles = 0;
+  Int_t     nPairsPresel = 0;
+  if(fUsePairPreselection && nSeleTrks>0) {
+    trkCircles = new Double_t[kNCirclePars*nSeleTrks];
+    FillTrackCircles(tracksAtVertex,nSeleTrks,trkCircles);
+  }
+
+  // DCA of each track pair, computed once per event (the 3- and 4-prong
+  // loops ask for the same pairs many times); the unlike-sign pairs are
+  // filled upfront by fNWorkerThreads threads, the others on first use.
+  // The table is kept for the next events, enlarged when needed.
+  Double_t *pairDCA = 0;
+  UChar_t  *pairOrder = 0;
+  if(nSeleTrks>1 && nSeleTrks<=kMaxTrksForPairDCA) {
+    Int_t nPairs = nSeleTrks*(nSeleTrks-1)/2;
+    if(nPairs>fPairDCASize) {
+      if(fPairDCA) delete [] fPairDCA;
+      if(fPairDCAOrder) delete [] fPairDCAOrder;
+      fPairDCA = new Double_t[nPairs];
+      fPairDCAOrder = new UChar_t[nPairs];
+      fPairDCASize = nPairs;
+    }
+    pairDCA = fPairDCA;
+    pairOrder = fPairDCAOrder;
+    memset(pairOrder,0,sizeof(UChar_t)*nPairs);
+    if(fNWorkerThreads>1) FillPairDCA(tracksAtVertex,nSeleTrks,seleFlags,trkCircles,dcaMax,pairDCA,pairOrder);
+  }
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -867,7 +916,12 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       negtrack1->GetPxPyPz(momneg1);
 
       // DCA between the two tracks
-      dcap1n1 = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+      if(trkCircles && PairFailsDCACut(&trkCircles[kNCirclePars*iTrkP1],&trkCircles[kNCirclePars*iTrkN1],dcaMax)) {
+	nPairsPresel++;
+	negtrack1=0;
+	continue;
+      }
+      dcap1n1 = GetPairDCA(tracksAtVertex,pairDCA,pairOrder,iTrkP1,iTrkN1);
       if(dcap1n1>dcaMax) { negtrack1=0; continue; }
 
       // Vertexing
@@ -1131,9 +1185,15 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 	//printf("********** %d %d %d\n",postrack1->GetID(),postrack2->GetID(),negtrack1->GetID());
 
-	dcap2n1 = postrack2->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+	if(trkCircles && (PairFailsDCACut(&trkCircles[kNCirclePars*iTrkP2],&trkCircles[kNCirclePars*iTrkN1],dcaMax) ||
+			  PairFailsDCACut(&trkCircles[kNCirclePars*iTrkP2],&trkCircles[kNCirclePars*iTrkP1],dcaMax))) {
+	  nPairsPresel++;
+	  postrack2=0;
+	  continue;
+	}
+	dcap2n1 = GetPairDCA(tracksAtVertex,pairDCA,pairOrder,iTrkP2,iTrkN1);
 	if(dcap2n1>dcaMax) { postrack2=0; continue; }
-	dcap1p2 = postrack2->GetDCA(postrack1,fBzkG,xdummy,ydummy);
+	dcap1p2 = GetPairDCA(tracksAtVertex,pairDCA,pairOrder,iTrkP2,iTrkP1);
 	if(dcap1p2>dcaMax) { postrack2=0; continue; }
 
 	// check invariant mass cuts for D+,Ds,Lc
@@ -1275,9 +1335,15 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    SetParametersAtVertex(postrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP2));
 	    SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 
-	    dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	    if(trkCircles && (PairFailsDCACut(&trkCircles[kNCirclePars*iTrkP1],&trkCircles[kNCirclePars*iTrkN2],fCutsD0toKpipipi->GetDCACut()) ||
+			      PairFailsDCACut(&trkCircles[kNCirclePars*iTrkP2],&trkCircles[kNCirclePars*iTrkN2],fCutsD0toKpipipi->GetDCACut()))) {
+	      nPairsPresel++;
+	      negtrack2=0;
+	      continue;
+	    }
+	    dcap1n2 = GetPairDCA(tracksAtVertex,pairDCA,pairOrder,iTrkP1,iTrkN2);
 	    if(dcap1n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
-            dcap2n2 = postrack2->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+            dcap2n2 = GetPairDCA(tracksAtVertex,pairDCA,pairOrder,iTrkP2,iTrkN2);
             if(dcap2n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
 
 
@@ -1409,9 +1475,15 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 	//printf("********** %d %d %d\n",postrack1->GetID(),negtrack1->GetID(),negtrack2->GetID());
 
-	dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	if(trkCircles && (PairFailsDCACut(&trkCircles[kNCirclePars*iTrkP1],&trkCircles[kNCirclePars*iTrkN2],dcaMax) ||
+			  PairFailsDCACut(&trkCircles[kNCirclePars*iTrkN1],&trkCircles[kNCirclePars*iTrkN2],dcaMax))) {
+	  nPairsPresel++;
+	  negtrack2=0;
+	  continue;
+	}
+	dcap1n2 = GetPairDCA(tracksAtVertex,pairDCA,pairOrder,iTrkP1,iTrkN2);
 	if(dcap1n2>dcaMax) { negtrack2=0; continue; }
-	dcan1n2 = negtrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	dcan1n2 = GetPairDCA(tracksAtVertex,pairDCA,pairOrder,iTrkN1,iTrkN2);
 	if(dcan1n2>dcaMax) { negtrack2=0; continue; }
 
 	threeTrackArray->AddAt(negtrack1,0);
@@ -1501,6 +1573,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
  }  // end 1st loop on positive tracks
 
 
+  if(trkCircles) {
+    AliDebug(1,Form(" Combinations rejected before GetDCA: %d",nPairsPresel));
+  }
   //  AliDebug(1,Form(" Total HF vertices in event = %d;",
   //		  (Int_t)aodVerticesHFTClArr->GetEntriesFast()));
   if(fD0toKpi) {
@@ -1545,6 +1620,8 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   threeTrackArray->Delete(); delete threeTrackArray;
   fourTrackArray->Delete();  delete fourTrackArray;
   delete [] seleFlags; seleFlags=NULL;
+  if(trkCircles) {delete [] trkCircles; trkCircles=NULL;}
+  pairDCA=NULL; pairOrder=NULL; // owned by fPairDCA, fPairDCAOrder
   if(evtNumber) {delete [] evtNumber; evtNumber=NULL;}
   tracksAtVertex.Delete();
 
@@ -2897,6 +2974,8 @@ void AliAnalysisVertexingHF::PrintStatus() const {
   }
   if(fRecoPrimVtxSkippingTrks) printf("RecoPrimVtxSkippingTrks\n");
   if(fRmTrksFromPrimVtx) printf("RmTrksFromPrimVtx\n");
+  if(fUsePairPreselection) printf("Track pairs pre-selected with helix circles before the DCA cut\n");
+  if(fNWorkerThreads>1) printf("Track-pair DCAs computed with %d threads\n",fNWorkerThreads);
   if(fD0toKpi) {
     printf("Reconstruct D0->Kpi candidates with cuts:\n");
     if(fCutsD0toKpi) fCutsD0toKpi->PrintAll();
@@ -3697,6 +3776,129 @@ void AliAnalysisVertexingHF::SetParametersAtVertex(AliESDtrack* esdt, const AliE
   return;
 }
 //-----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::FillTrackCircles(const TObjArray &tracksAtVertex,Int_t nSeleTrks,Double_t *circles) const{
+  /// Store, for each selected track, the circle of its helix in the
+  /// transverse plane (centre x, centre y, radius) and its sigmaY2, sigmaZ2
+  /// at the primary vertex. A negative radius means "no bound" (straight
+  /// tracks, B=0 or non-positive errors), i.e. the pair is never skipped.
+
+  for(Int_t i=0; i<nSeleTrks; i++) {
+    const AliExternalTrackParam *t = (const AliExternalTrackParam*)tracksAtVertex.UncheckedAt(i);
+    Double_t *circ = &circles[kNCirclePars*i];
+    Double_t xyz[3],pxpypz[3];
+    t->GetXYZ(xyz);
+    t->GetPxPyPz(pxpypz);
+    Double_t pt = TMath::Sqrt(pxpypz[0]*pxpypz[0]+pxpypz[1]*pxpypz[1]);
+    Double_t c = t->GetC(fBzkG);
+    circ[3] = t->GetSigmaY2();
+    circ[4] = t->GetSigmaZ2();
+    if(pt<=0. || TMath::Abs(c)<1.e-7 || circ[3]<=0. || circ[4]<=0.) {
+      circ[0] = circ[1] = 0.;
+      circ[2] = -1.;
+      continue;
+    }
+    // same parametrisation as AliExternalTrackParam::Evaluate()
+    circ[0] = xyz[0] - pxpypz[1]/(pt*c);
+    circ[1] = xyz[1] + pxpypz[0]/(pt*c);
+    circ[2] = 1./TMath::Abs(c);
+  }
+  return;
+}
+//-----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::PairFailsDCACut(const Double_t *circ1,const Double_t *circ2,Double_t dcaCut) const{
+  /// kTRUE if AliExternalTrackParam::GetDCA() is guaranteed to be above dcaCut.
+  /// GetDCA() returns sqrt(dxy^2*sqrt(sz2/sy2)+dz^2*sqrt(sy2/sz2)) for two
+  /// points on the helices, which is >= dxy*(sz2/sy2)^(1/4) with dxy the
+  /// minimum distance between the two circles in the transverse plane.
+
+  if(circ1[2]<0. || circ2[2]<0.) return kFALSE;
+
+  Double_t dx = circ1[0]-circ2[0];
+  Double_t dy = circ1[1]-circ2[1];
+  Double_t d = TMath::Sqrt(dx*dx+dy*dy);
+  Double_t dxy = 0.;
+  if(d>circ1[2]+circ2[2]) dxy = d-circ1[2]-circ2[2]; // disjoint circles
+  else dxy = TMath::Abs(circ1[2]-circ2[2])-d;         // one circle inside the other
+  if(dxy<=0.) return kFALSE;                           // intersecting circles
+
+  Double_t sy2 = circ1[3]+circ2[3];
+  Double_t sz2 = circ1[4]+circ2[4];
+  Double_t cut = dcaCut*(1.+1.e-6)+1.e-6; // margin for rounding
+  return (dxy*dxy*TMath::Sqrt(sz2/sy2) > cut*cut);
+}
+//-----------------------------------------------------------------------------
+Double_t AliAnalysisVertexingHF::GetPairDCA(const TObjArray &tracksAtVertex,Double_t *pairDCA,UChar_t *pairOrder,Int_t i,Int_t j) const{
+  /// DCA of track i to track j (i->GetDCA(j)) with the parameters at the
+  /// primary vertex, taken from / stored into the per-event pair table if any.
+  /// The table has one entry per pair; it is used only if it was computed
+  /// with the same track order, so that the result is the one of i->GetDCA(j)
+
+  if(pairDCA && pairOrder[PairDCAIndex(i,j)]==PairDCAOrder(i,j)) return pairDCA[PairDCAIndex(i,j)];
+
+  Double_t xdummy,ydummy;
+  const AliExternalTrackParam *ti = (const AliExternalTrackParam*)tracksAtVertex.UncheckedAt(i);
+  const AliExternalTrackParam *tj = (const AliExternalTrackParam*)tracksAtVertex.UncheckedAt(j);
+  Double_t dca = ti->GetDCA(tj,fBzkG,xdummy,ydummy);
+  if(pairDCA) {
+    pairDCA[PairDCAIndex(i,j)] = dca;
+    pairOrder[PairDCAIndex(i,j)] = PairDCAOrder(i,j);
+  }
+  return dca;
+}
+//-----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::FillPairDCARows(const TObjArray &tracksAtVertex,Int_t nSeleTrks,
+					     const UChar_t *seleFlags,const Double_t *circles,
+					     Double_t dcaMax,Double_t *pairDCA,UChar_t *pairOrder,
+					     Int_t firstRow,Int_t lastRow) const{
+  /// Fill the DCA of the unlike-sign displaced pairs (positive first) for the
+  /// positive tracks in [firstRow,lastRow). Only reads the tracks at vertex and
+  /// writes the entries of the pairs of these tracks, so that rows can be
+  /// filled in parallel.
+
+  for(Int_t i=firstRow; i<lastRow; i++) {
+    if(!TESTBIT(seleFlags[i],kBitDispl)) continue;
+    const AliExternalTrackParam *ti = (const AliExternalTrackParam*)tracksAtVertex.UncheckedAt(i);
+    if(ti->Charge()<0) continue;
+    for(Int_t j=0; j<nSeleTrks; j++) {
+      if(j==i || !TESTBIT(seleFlags[j],kBitDispl)) continue;
+      const AliExternalTrackParam *tj = (const AliExternalTrackParam*)tracksAtVertex.UncheckedAt(j);
+      if(tj->Charge()>0) continue;
+      if(circles && PairFailsDCACut(&circles[kNCirclePars*i],&circles[kNCirclePars*j],dcaMax)) continue;
+      Double_t xdummy,ydummy;
+      pairDCA[PairDCAIndex(i,j)] = ti->GetDCA(tj,fBzkG,xdummy,ydummy);
+      pairOrder[PairDCAIndex(i,j)] = PairDCAOrder(i,j);
+    }
+  }
+  return;
+}
+//-----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::FillPairDCA(const TObjArray &tracksAtVertex,Int_t nSeleTrks,
+					 const UChar_t *seleFlags,const Double_t *circles,
+					 Double_t dcaMax,Double_t *pairDCA,UChar_t *pairOrder) const{
+  /// Split the rows of the pair DCA table among fNWorkerThreads threads.
+  /// Each entry only depends on the two tracks, so the result does not
+  /// depend on the number of threads.
+
+#if __cplusplus >= 201103L
+  Int_t nThreads = TMath::Min(fNWorkerThreads,nSeleTrks);
+  if(nThreads>1) {
+    std::vector<std::thread> workers;
+    workers.reserve(nThreads);
+    for(Int_t ith=0; ith<nThreads; ith++) {
+      Int_t firstRow = (Int_t)((Long64_t)nSeleTrks*ith/nThreads);
+      Int_t lastRow  = (Int_t)((Long64_t)nSeleTrks*(ith+1)/nThreads);
+      workers.push_back(std::thread(&AliAnalysisVertexingHF::FillPairDCARows,this,
+				    std::cref(tracksAtVertex),nSeleTrks,seleFlags,circles,
+				    dcaMax,pairDCA,pairOrder,firstRow,lastRow));
+    }
+    for(Int_t ith=0; ith<nThreads; ith++) workers[ith].join();
+    return;
+  }
+#endif
+  FillPairDCARows(tracksAtVertex,nSeleTrks,seleFlags,circles,dcaMax,pairDCA,pairOrder,0,nSeleTrks);
+  return;
+}
+//-----------------------------------------------------------------------------
 void AliAnalysisVertexingHF::SetMasses(){
   /// Set the hadron mass values from TDatabasePDG
 
@@ -179,6 +179,8 @@ class AliAnalysisVertexingHF : public TNamed {
   void SetCutsDStartoKpipi(AliRDHFCutsDStartoKpipi* cuts) { fCutsDStartoKpipi = cuts; }
   AliRDHFCutsDStartoKpipi* GetCutsDStartoKpipi() const { return fCutsDStartoKpipi; }
   void SetMassCutBeforeVertexing(Bool_t flag) { fMassCutBeforeVertexing=flag; }
+  void SetUsePairPreselection(Bool_t flag=kTRUE) { fUsePairPreselection=flag; }
+  void SetNWorkerThreads(Int_t n) { fNWorkerThreads=n; }
 
   void SetMasses();
   Bool_t CheckCutsConsistency();
@@ -247,6 +249,8 @@ class AliAnalysisVertexingHF : public TNamed {
  private:
   //
   enum { kBitDispl = 0, kBitSoftPi = 1, kBit3Prong = 2, kBitPionCompat = 3, kBitKaonCompat = 4, kBitProtonCompat = 5, kBitBachelor = 6};
+  enum { kNCirclePars = 5 }; // x, y, radius of the helix circle, sigmaY2, sigmaZ2
+  enum { kMaxTrksForPairDCA = 2000 }; // max. selected tracks for the per-event pair DCA table
 
   Bool_t fInputAOD; /// input from AOD (kTRUE) or ESD (kFALSE)
   Int_t fAODMapSize; /// size of fAODMap
@@ -324,6 +328,11 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t fFindVertexForCascades;  /// reconstruct a secondary vertex or assume it's from the primary vertex
   Int_t  fV0TypeForCascadeVertex;  /// Select which V0 type we want to use for the cascas
   Bool_t fMassCutBeforeVertexing; /// to go faster in PbPb
+  Bool_t fUsePairPreselection; /// skip track pairs whose helix circles are too far apart for the DCA cut
+  Int_t  fNWorkerThreads; /// number of threads filling the track-pair DCA table (<=1: no threads)
+  Int_t  fPairDCASize; //! allocated size of fPairDCA
+  Double_t *fPairDCA; //! track-pair DCA table (one entry per pair, see PairDCAIndex), reused for the next events
+  UChar_t *fPairDCAOrder; //! track order of each fPairDCA entry (see PairDCAOrder), 0 if not computed
   // dummies for invariant mass calculation
   AliAODRecoDecay *fMassCalc2; /// for 2 prong
   AliAODRecoDecay *fMassCalc3; /// for 3 prong
@@ -411,6 +420,16 @@ class AliAnalysisVertexingHF : public TNamed {
 				   Int_t &nSeleTrks,
 				   UChar_t *seleFlags,Int_t *evtNumber);
   void SetParametersAtVertex(AliESDtrack* esdt, const AliExternalTrackParam* extpar) const;
+  void FillTrackCircles(const TObjArray &tracksAtVertex,Int_t nSeleTrks,Double_t *circles) const;
+  Bool_t PairFailsDCACut(const Double_t *circ1,const Double_t *circ2,Double_t dcaCut) const;
+  Int_t PairDCAIndex(Int_t i,Int_t j) const { return i>j ? i*(i-1)/2+j : j*(j-1)/2+i; }
+  UChar_t PairDCAOrder(Int_t i,Int_t j) const { return i>j ? 1 : 2; }
+  Double_t GetPairDCA(const TObjArray &tracksAtVertex,Double_t *pairDCA,UChar_t *pairOrder,Int_t i,Int_t j) const;
+  void FillPairDCARows(const TObjArray &tracksAtVertex,Int_t nSeleTrks,const UChar_t *seleFlags,
+		       const Double_t *circles,Double_t dcaMax,Double_t *pairDCA,UChar_t *pairOrder,
+		       Int_t firstRow,Int_t lastRow) const;
+  void FillPairDCA(const TObjArray &tracksAtVertex,Int_t nSeleTrks,const UChar_t *seleFlags,
+		   const Double_t *circles,Double_t dcaMax,Double_t *pairDCA,UChar_t *pairOrder) const;
 
   Bool_t SingleTrkCuts(AliESDtrack *trk,Float_t centralityperc, Bool_t &okDisplaced,Bool_t &okSoftPi, Bool_t &ok3prong, Bool_t &okBachelor) const;
 
@@ -420,7 +439,7 @@ class AliAnalysisVertexingHF : public TNamed {
 				  TObjArray *twoTrackArrayV0);
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisVertexingHF,27);  // Reconstruction of HF decay candidates
+  ClassDef(AliAnalysisVertexingHF,30);  // Reconstruction of HF decay candidates
   /// \endcond
 };
 
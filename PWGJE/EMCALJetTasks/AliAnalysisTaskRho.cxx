@@ -21,7 +21,8 @@ ClassImp(AliAnalysisTaskRho)
 //________________________________________________________________________
 AliAnalysisTaskRho::AliAnalysisTaskRho() : 
   AliAnalysisTaskRhoBase("AliAnalysisTaskRho"),
-  fNExclLeadJets(0)
+  fNExclLeadJets(0),
+  fRhoVec()
 {
   // Constructor.
 }
@@ -29,7 +30,8 @@ AliAnalysisTaskRho::AliAnalysisTaskRho() :
 //________________________________________________________________________
 AliAnalysisTaskRho::AliAnalysisTaskRho(const char *name, Bool_t histo) :
   AliAnalysisTaskRhoBase(name, histo),
-  fNExclLeadJets(0)
+  fNExclLeadJets(0),
+  fRhoVec()
 {
   // Constructor.
 }
@@ -79,7 +81,8 @@ Bool_t AliAnalysisTaskRho::Run()
     }
   }
 
-  static Double_t rhovec[999];
+  if (fRhoVec.GetSize() < Njets) fRhoVec.Set(Njets);
+  Double_t *rhovec = fRhoVec.GetArray();
   Int_t NjetAcc = 0;
 
   // push all jets within selected acceptance into stack
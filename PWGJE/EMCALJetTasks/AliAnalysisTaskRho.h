@@ -3,6 +3,8 @@
 
 // $Id$
 
+#include <TArrayD.h>
+
 #include "AliAnalysisTaskRhoBase.h"
 
 class AliAnalysisTaskRho : public AliAnalysisTaskRhoBase {
@@ -19,9 +21,11 @@ class AliAnalysisTaskRho : public AliAnalysisTaskRhoBase {
 
   UInt_t           fNExclLeadJets;                 // number of leading jets to be excluded from the median calculation
 
+  TArrayD          fRhoVec;                        //!pt/area of the accepted jets, used for the median
+
   AliAnalysisTaskRho(const AliAnalysisTaskRho&);             // not implemented
   AliAnalysisTaskRho& operator=(const AliAnalysisTaskRho&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRho, 10); // Rho task
+  ClassDef(AliAnalysisTaskRho, 11); // Rho task
 };
 #endif
@@ -45,8 +45,6 @@ Bool_t AliAnalysisTaskRhoAverage::Run()
 {
   // Run the analysis.
 
-  const Int_t NMAX = 9999;
-  static Double_t rhovec[NMAX];
   Int_t NpartAcc = 0;
 
   Int_t   maxPartIds[] = {0, 0};
@@ -57,6 +55,12 @@ Bool_t AliAnalysisTaskRhoAverage::Run()
   AliParticleContainer* tracks = GetParticleContainer(0);
   AliClusterContainer* clusters = GetClusterContainer(0);
 
+  Int_t NpartMax = 0;
+  if (tracks && (fRhoType == 0 || fRhoType == 1)) NpartMax += tracks->GetNParticles();
+  if (clusters && (fRhoType == 0 || fRhoType == 2)) NpartMax += clusters->GetNClusters();
+  if (fRhoVec.GetSize() < NpartMax) fRhoVec.Set(NpartMax);
+  Double_t *rhovec = fRhoVec.GetArray();
+
   if (fNExclLeadPart > 0) {
 
     if (tracks && (fRhoType == 0 || fRhoType == 1)) {
@@ -108,7 +112,7 @@ Bool_t AliAnalysisTaskRhoAverage::Run()
   if (tracks && (fRhoType == 0 || fRhoType == 1)) {
     AliVParticle *track = 0;
     tracks->ResetCurrentID();
-    while ((track = tracks->GetNextAcceptParticle()) && NpartAcc < NMAX) {
+    while ((track = tracks->GetNextAcceptParticle())) {
 
       // exlcuding lead particles
       if (tracks->GetCurrentID() == maxPartIds[0]-1 || tracks->GetCurrentID() == maxPartIds[1]-1)
@@ -123,7 +127,7 @@ Bool_t AliAnalysisTaskRhoAverage::Run()
 
     AliVCluster *cluster = 0;
     clusters->ResetCurrentID();
-    while ((cluster = clusters->GetNextAcceptCluster()) && NpartAcc < NMAX) {
+    while ((cluster = clusters->GetNextAcceptCluster())) {
       // exlcuding lead particles
       if (clusters->GetCurrentID() == -maxPartIds[0]-1 || clusters->GetCurrentID() == -maxPartIds[1]-1)
         continue;
@@ -136,10 +140,6 @@ Bool_t AliAnalysisTaskRhoAverage::Run()
     }
   }
 
-  if (NpartAcc == NMAX) {
-    AliError(Form("%s: NpartAcc >= %d", GetName(), NMAX));
-  }
-
   Double_t rho = 0;
 
   if (NpartAcc > 0) {
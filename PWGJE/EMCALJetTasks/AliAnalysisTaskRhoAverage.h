@@ -3,6 +3,8 @@
 
 // $Id$
 
+#include <TArrayD.h>
+
 #include "AliAnalysisTaskRhoBase.h"
 
 class AliAnalysisTaskRhoAverage : public AliAnalysisTaskRhoBase {
@@ -24,10 +26,11 @@ class AliAnalysisTaskRhoAverage : public AliAnalysisTaskRhoBase {
   UInt_t           fNExclLeadPart ;// number of leading particles to be excluded from the median calculation
   Bool_t           fUseMedian     ;// whether or not use the median to calculate rho (mean is used if false)
   Double_t         fTotalArea     ;//!total area
+  TArrayD          fRhoVec        ;//!pt of the accepted particles, used for the median or mean
 
   AliAnalysisTaskRhoAverage(const AliAnalysisTaskRhoAverage&);             // not implemented
   AliAnalysisTaskRhoAverage& operator=(const AliAnalysisTaskRhoAverage&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoAverage, 4); // Rho task
+  ClassDef(AliAnalysisTaskRhoAverage, 5); // Rho task
 };
 #endif
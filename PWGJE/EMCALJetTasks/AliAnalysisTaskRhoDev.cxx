@@ -104,13 +104,14 @@ void AliAnalysisTaskRhoDev::CalculateRho()
 
   auto maxJets = GetLeadingJets();
 
-  static Double_t rhovec[999];
   Int_t NjetAcc = 0;
   Double_t TotaljetArea = 0; // Total area of background jets (including ghost jets)
   Double_t TotaljetAreaPhys = 0; // Total area of physical background jets (excluding ghost jets)
   // Ghost jet is a jet made only of ghost particles
 
   AliJetContainer* bkgJetCont = fJetCollArray["Background"];
+  if (fRhoVec.GetSize() < bkgJetCont->GetNJets()) fRhoVec.Set(bkgJetCont->GetNJets());
+  Double_t *rhovec = fRhoVec.GetArray();
   AliJetContainer* sigJetCont = nullptr;
   if (!fExclJetOverlap.IsNull()) {
     auto sigJetContIt = fJetCollArray.find(fExclJetOverlap.Data());
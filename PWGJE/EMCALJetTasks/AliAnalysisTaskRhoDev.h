@@ -17,6 +17,8 @@
 
 #include <utility>
 
+#include <TArrayD.h>
+
 #include "AliAnalysisTaskRhoBaseDev.h"
 
 /** \class AliAnalysisTaskRhoDev
@@ -72,12 +74,13 @@ class AliAnalysisTaskRhoDev : public AliAnalysisTaskRhoBaseDev {
 
   Double_t         fOccupancyFactor;               //!<!occupancy correction factor for sparse events
   TH2F            *fHistOccCorrvsCent;             //!<!occupancy correction vs. centrality
+  TArrayD          fRhoVec;                        //!<!pt/area of the accepted jets, used for the median
 
   AliAnalysisTaskRhoDev(const AliAnalysisTaskRhoDev&);             // not implemented
   AliAnalysisTaskRhoDev& operator=(const AliAnalysisTaskRhoDev&);  // not implemented
   
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskRhoDev, 2);
+  ClassDef(AliAnalysisTaskRhoDev, 3);
   /// \endcond
 };
 #endif
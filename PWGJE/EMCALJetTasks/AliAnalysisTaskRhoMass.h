@@ -3,6 +3,8 @@
 
 // $Id$
 
+#include <TArrayD.h>
+
 #include "AliAnalysisTaskRhoMassBase.h"
 
 class AliAnalysisTaskRhoMass : public AliAnalysisTaskRhoMassBase {
@@ -37,9 +39,13 @@ class AliAnalysisTaskRhoMass : public AliAnalysisTaskRhoMassBase {
 
   TH2F            *fHistMdAreavsCent;              //! Md/Area vs cent for all kt clusters
 
+  TArrayD          fRhoMVec;                       //! Md/Area of the accepted jets, used for the median
+  TArrayD          fEVec;                          //! energy of the accepted jets
+  TArrayD          fMVec;                          //! mass of the accepted jets
+
   AliAnalysisTaskRhoMass(const AliAnalysisTaskRhoMass&);             // not implemented
   AliAnalysisTaskRhoMass& operator=(const AliAnalysisTaskRhoMass&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoMass, 2); // Rho_m task
+  ClassDef(AliAnalysisTaskRhoMass, 3); // Rho_m task
 };
 #endif
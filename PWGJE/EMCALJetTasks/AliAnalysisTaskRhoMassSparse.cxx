@@ -137,9 +137,14 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     }
   }
 
-  static Double_t rhomvec[999];
-  static Double_t Evec[999];
-  static Double_t Mvec[999];
+  if (fRhoMVec.GetSize() < Njets) {
+    fRhoMVec.Set(Njets);
+    fEVec.Set(Njets);
+    fMVec.Set(Njets);
+  }
+  Double_t *rhomvec = fRhoMVec.GetArray();
+  Double_t *Evec = fEVec.GetArray();
+  Double_t *Mvec = fMVec.GetArray();
   Int_t NjetAcc = 0;
   Double_t TotaljetArea=0;
   Double_t TotaljetAreaPhys=0;
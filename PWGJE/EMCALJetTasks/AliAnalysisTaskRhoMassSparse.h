@@ -3,6 +3,8 @@
 
 // $Id$
 
+#include <TArrayD.h>
+
 #include "AliAnalysisTaskRhoMassBase.h"
 
 class AliAnalysisTaskRhoMassSparse : public AliAnalysisTaskRhoMassBase {
@@ -43,9 +45,13 @@ class AliAnalysisTaskRhoMassSparse : public AliAnalysisTaskRhoMassBase {
   TH2F            *fHistMdAreavsCent;              //! Md/Area vs cent for all kt clusters
   TH2F            *fHistOccCorrvsCent;             //!occupancy correction vs. centrality
 
+  TArrayD          fRhoMVec;                       //! Md/Area of the accepted jets, used for the median
+  TArrayD          fEVec;                          //! energy of the accepted jets
+  TArrayD          fMVec;                          //! mass of the accepted jets
+
   AliAnalysisTaskRhoMassSparse(const AliAnalysisTaskRhoMassSparse&);             // not implemented
   AliAnalysisTaskRhoMassSparse& operator=(const AliAnalysisTaskRhoMassSparse&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoMassSparse, 1); // Rho_m task
+  ClassDef(AliAnalysisTaskRhoMassSparse, 2); // Rho_m task
 };
 #endif
@@ -126,7 +126,8 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
     }
   }
 
-  static Double_t rhovec[999];
+  if (fRhoVec.GetSize() < Njets) fRhoVec.Set(Njets);
+  Double_t *rhovec = fRhoVec.GetArray();
   Int_t NjetAcc = 0;
   Double_t TotaljetArea=0;
   Double_t TotaljetAreaPhys=0;
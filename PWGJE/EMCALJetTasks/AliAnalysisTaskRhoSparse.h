@@ -3,6 +3,8 @@
 
 // $Id$
 
+#include <TArrayD.h>
+
 #include "AliAnalysisTaskRhoBase.h"
 
 class AliAnalysisTaskRhoSparse : public AliAnalysisTaskRhoBase {
@@ -25,10 +27,11 @@ class AliAnalysisTaskRhoSparse : public AliAnalysisTaskRhoBase {
   Bool_t           fRhoCMS;                        // flag to run CMS method
 
   TH2F            *fHistOccCorrvsCent;             //!occupancy correction vs. centrality
+  TArrayD          fRhoVec;                        //!pt/area of the accepted jets, used for the median
 
   AliAnalysisTaskRhoSparse(const AliAnalysisTaskRhoSparse&);             // not implemented
   AliAnalysisTaskRhoSparse& operator=(const AliAnalysisTaskRhoSparse&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoSparse, 2); // Rho task
+  ClassDef(AliAnalysisTaskRhoSparse, 3); // Rho task
 };
 #endif
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include <TClonesArray.h>
+#include <TH1D.h>
 #include <TMath.h>
 #include <TRandom3.h>
 
@@ -25,6 +26,7 @@
 #include <AliEMCALGeometry.h>
 
 #include <AliAnalysisManager.h>
+#include <AliAnalysisDataContainer.h>
 #include <AliVEventHandler.h>
 #include <AliMultiInputEventHandler.h>
 
@@ -35,6 +37,7 @@
 #include "AliEmcalJetUtility.h"
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
+#include "AliEmcalList.h"
 
 #include "AliEmcalJetTask.h"
 
@@ -70,6 +73,8 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fUtilities(0),
   fTrackEfficiencyOnlyForEmbedding(kFALSE),
   fLocked(0),
+  fTimingInfo(kFALSE),
+  fRandomSeed(0),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -78,6 +83,20 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fFillGhost(kFALSE),
   fJets(0),
   fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
+  fSortedJetIndexes(),
+  fSortedJetPts(),
+  fRandom(),
+  fInputPx(),
+  fInputPy(),
+  fInputPz(),
+  fInputE(),
+  fInputUid(),
+  fTimer(),
+  fTimeInput(0),
+  fTimeClustering(0),
+  fTimeBranch(0),
+  fNTimedEvents(0),
+  fHistTiming(0),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
 {
@@ -105,6 +124,8 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fUtilities(0),
   fTrackEfficiencyOnlyForEmbedding(kFALSE),
   fLocked(0),
+  fTimingInfo(kFALSE),
+  fRandomSeed(0),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -113,6 +134,20 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fFillGhost(kFALSE),
   fJets(0),
   fFastJetWrapper(name,name),
+  fSortedJetIndexes(),
+  fSortedJetPts(),
+  fRandom(),
+  fInputPx(),
+  fInputPy(),
+  fInputPz(),
+  fInputE(),
+  fInputUid(),
+  fTimer(),
+  fTimeInput(0),
+  fTimeClustering(0),
+  fTimeBranch(0),
+  fNTimedEvents(0),
+  fHistTiming(0),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
 {
@@ -197,6 +232,50 @@ void AliEmcalJetTask::TerminateUtilities()
   while ((utility=static_cast<AliEmcalJetUtility*>(next()))) utility->Terminate(fFastJetWrapper);
 }
 
+/**
+ * Enables the measurement of the CPU time spent in the steps of the jet finding.
+ * The totals are also stored in the histogram fHistTiming of the task output, so
+ * that they are summed when the outputs are merged. This defines the output slot
+ * of the task, so it must be called before the task is added to the analysis
+ * manager, and the output must be connected afterwards. AddTaskEmcalJet does
+ * both if its bTimingInfo argument is set.
+ * @param b Whether the timing information is measured
+ */
+void AliEmcalJetTask::SetTimingInfo(Bool_t b)
+{
+  fTimingInfo = b;
+  if (!fTimingInfo || fCreateHisto) return;
+
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (mgr && mgr->GetTask(GetName())) {
+    AliError(Form("%s: SetTimingInfo() must be called before the task is added to the analysis manager, the timing histogram is not available.", GetName()));
+    return;
+  }
+
+  fCreateHisto = kTRUE;
+  DefineOutput(1, AliEmcalList::Class());
+}
+
+/**
+ * Creates the output list (see AliAnalysisTaskEmcal) and, if the timing
+ * information is requested, the timing histogram.
+ */
+void AliEmcalJetTask::UserCreateOutputObjects()
+{
+  AliAnalysisTaskEmcal::UserCreateOutputObjects();
+
+  if (!fTimingInfo || !fOutput) return;
+
+  fHistTiming = new TH1D("fHistTiming", "CPU time of the jet finding steps;;CPU time (s) or events", 4, 0, 4);
+  fHistTiming->GetXaxis()->SetBinLabel(1, "Input");
+  fHistTiming->GetXaxis()->SetBinLabel(2, "Clustering (incl. areas)");
+  fHistTiming->GetXaxis()->SetBinLabel(3, "Branch fill");
+  fHistTiming->GetXaxis()->SetBinLabel(4, "Timed events");
+  fOutput->Add(fHistTiming);
+
+  PostData(1, fOutput);
+}
+
 /**
  * This method is called for each event.
  * @return Always kTRUE
@@ -210,11 +289,30 @@ Bool_t AliEmcalJetTask::Run()
 
   if (n == 0) return kFALSE;
 
+  if (fTimingInfo) fTimer.Start(kTRUE);
   FillJetBranch();
+  if (fTimingInfo) {
+    fTimer.Stop();
+    fTimeBranch += fTimer.CpuTime();
+    if (fHistTiming) fHistTiming->Fill(2.5, fTimer.CpuTime());
+    AliDebug(1,Form("Timing (CPU ms): branch fill %.3f", fTimer.CpuTime()*1e3));
+  }
 
   return kTRUE;
 }
 
+/**
+ * Prints the average CPU time per event spent in the different steps
+ * of the jet finding, if the timing information was requested.
+ */
+void AliEmcalJetTask::Terminate(Option_t *)
+{
+  if (!fTimingInfo || fNTimedEvents == 0) return;
+
+  AliInfo(Form("%s: average CPU time per event over %d events: input %.3f ms, clustering (incl. areas) %.3f ms, branch fill %.3f ms",
+      GetName(), fNTimedEvents, fTimeInput / fNTimedEvents * 1e3, fTimeClustering / fNTimedEvents * 1e3, fTimeBranch / fNTimedEvents * 1e3));
+}
+
 /**
  * This method steers the jet finding. It first loops over all particle and cluster containers
  * that were provided when the task was initialized. All accepted objects (tracks, particle, clusters)
@@ -229,13 +327,31 @@ Int_t AliEmcalJetTask::FindJets()
     return 0;
   }
 
+  if (fTimingInfo) fTimer.Start(kTRUE);
+
   fFastJetWrapper.Clear();
 
   AliDebug(2,Form("Jet type = %d", fJetType));
 
+  // reserve the input buffers once for all containers
+  Int_t nInputMax = 0;
+  TIter nextPartCollSize(&fParticleCollArray);
+  AliParticleContainer* tracks = 0;
+  while ((tracks = static_cast<AliParticleContainer*>(nextPartCollSize()))) nInputMax += tracks->GetNParticles();
+  TIter nextClusCollSize(&fClusterCollArray);
+  AliClusterContainer* clusters = 0;
+  while ((clusters = static_cast<AliClusterContainer*>(nextClusCollSize()))) nInputMax += clusters->GetNClusters();
+  if (fInputPx.GetSize() < nInputMax) {
+    fInputPx.Set(nInputMax);
+    fInputPy.Set(nInputMax);
+    fInputPz.Set(nInputMax);
+    fInputE.Set(nInputMax);
+    fInputUid.Set(nInputMax);
+  }
+  Int_t nInput = 0;
+
   Int_t iColl = 1;
   TIter nextPartColl(&fParticleCollArray);
-  AliParticleContainer* tracks = 0;
   while ((tracks = static_cast<AliParticleContainer*>(nextPartColl()))) {
     AliDebug(2,Form("Tracks from collection %d: '%s'. Embedded: %i, nTracks: %i", iColl-1, tracks->GetName(), tracks->GetIsEmbedding(), tracks->GetNParticles()));
     AliParticleIterableMomentumContainer itcont = tracks->accepted_momentum();
@@ -243,7 +359,7 @@ Int_t AliEmcalJetTask::FindJets()
       // artificial inefficiency
       if (fTrackEfficiency < 1.) {
         if (fTrackEfficiencyOnlyForEmbedding == kFALSE || (fTrackEfficiencyOnlyForEmbedding == kTRUE && tracks->GetIsEmbedding())) {
-          Double_t rnd = gRandom->Rndm();
+          Double_t rnd = fRandom.Rndm();
           if (fTrackEfficiency < rnd) {
             AliDebug(2,Form("Track %d rejected due to artificial tracking inefficiency", it.current_index()));
             continue;
@@ -252,30 +368,57 @@ Int_t AliEmcalJetTask::FindJets()
       }
 
       AliDebug(2,Form("Track %d accepted (label = %d, pt = %f, eta = %f, phi = %f, E = %f, m = %f, px = %f, py = %f, pz = %f)", it.current_index(), it->second->GetLabel(), it->first.Pt(), it->first.Eta(), it->first.Phi(), it->first.E(), it->first.M(), it->first.Px(), it->first.Py(), it->first.Pz()));
-      Int_t uid = it.current_index() + fgkConstIndexShift * iColl;
-      fFastJetWrapper.AddInputVector(it->first.Px(), it->first.Py(), it->first.Pz(), it->first.E(), uid);
+      fInputPx[nInput] = it->first.Px();
+      fInputPy[nInput] = it->first.Py();
+      fInputPz[nInput] = it->first.Pz();
+      fInputE[nInput] = it->first.E();
+      fInputUid[nInput] = it.current_index() + fgkConstIndexShift * iColl;
+      nInput++;
     }
     iColl++;
   }
 
   iColl = 1;
   TIter nextClusColl(&fClusterCollArray);
-  AliClusterContainer* clusters = 0;
   while ((clusters = static_cast<AliClusterContainer*>(nextClusColl()))) {
     AliDebug(2,Form("Clusters from collection %d: '%s'. Embedded: %i, nClusters: %i", iColl-1, clusters->GetName(), clusters->GetIsEmbedding(), clusters->GetNClusters()));
     AliClusterIterableMomentumContainer itcont = clusters->accepted_momentum();
     for (AliClusterIterableMomentumContainer::iterator it = itcont.begin(); it != itcont.end(); it++) {
       AliDebug(2,Form("Cluster %d accepted (label = %d, energy = %.3f)", it.current_index(), it->second->GetLabel(), it->first.E()));
-      Int_t uid = -it.current_index() - fgkConstIndexShift * iColl;
-      fFastJetWrapper.AddInputVector(it->first.Px(), it->first.Py(), it->first.Pz(), it->first.E(), uid);
+      fInputPx[nInput] = it->first.Px();
+      fInputPy[nInput] = it->first.Py();
+      fInputPz[nInput] = it->first.Pz();
+      fInputE[nInput] = it->first.E();
+      fInputUid[nInput] = -it.current_index() - fgkConstIndexShift * iColl;
+      nInput++;
     }
     iColl++;
   }
 
+  fFastJetWrapper.AddInputVectors(nInput, fInputPx.GetArray(), fInputPy.GetArray(), fInputPz.GetArray(), fInputE.GetArray(), fInputUid.GetArray());
+
+  if (fTimingInfo) {
+    fTimer.Stop();
+    fTimeInput += fTimer.CpuTime();
+    fNTimedEvents++;
+    if (fHistTiming) {
+      fHistTiming->Fill(0.5, fTimer.CpuTime());
+      fHistTiming->Fill(3.5);
+    }
+    AliDebug(1,Form("Timing (CPU ms): input %.3f (%d input vectors)", fTimer.CpuTime()*1e3, nInput));
+  }
+
   if (fFastJetWrapper.GetInputVectors().size() == 0) return 0;
 
   // run jet finder
+  if (fTimingInfo) fTimer.Start(kTRUE);
   fFastJetWrapper.Run();
+  if (fTimingInfo) {
+    fTimer.Stop();
+    fTimeClustering += fTimer.CpuTime();
+    if (fHistTiming) fHistTiming->Fill(1.5, fTimer.CpuTime());
+    AliDebug(1,Form("Timing (CPU ms): clustering (incl. areas) %.3f", fTimer.CpuTime()*1e3));
+  }
 
   return fFastJetWrapper.GetInclusiveJets().size();
 }
@@ -290,14 +433,13 @@ void AliEmcalJetTask::FillJetBranch()
   PrepareUtilities();
 
   // loop over fastjet jets
-  std::vector<fastjet::PseudoJet> jets_incl = fFastJetWrapper.GetInclusiveJets();
+  const std::vector<fastjet::PseudoJet> &jets_incl = fFastJetWrapper.GetInclusiveJets();
   // sort jets according to jet pt
-  static Int_t indexes[9999] = {-1};
-  GetSortedArray(indexes, jets_incl);
+  GetSortedArray(fSortedJetIndexes, jets_incl);
 
   AliDebug(1,Form("%d jets found", (Int_t)jets_incl.size()));
   for (UInt_t ijet = 0, jetCount = 0; ijet < jets_incl.size(); ++ijet) {
-    Int_t ij = indexes[ijet];
+    Int_t ij = fSortedJetIndexes[ijet];
     AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fFastJetWrapper.GetJetArea(ij)));
 
     if (jets_incl[ij].perp() < fMinJetPt) continue;
@@ -340,23 +482,25 @@ void AliEmcalJetTask::FillJetBranch()
 
 /**
  * Sorts jets by pT (decreasing)
- * @param[out] indexes This array is used to return the indexes of the jets ordered by pT
+ * @param[out] indexes This array is used to return the indexes of the jets ordered by pT (enlarged if needed)
  * @param[in] array Vector containing the list of jets obtained by the FastJet wrapper
  * @return kTRUE if at least one jet was found in array; kFALSE otherwise
  */
-Bool_t AliEmcalJetTask::GetSortedArray(Int_t indexes[], std::vector<fastjet::PseudoJet> array) const
+Bool_t AliEmcalJetTask::GetSortedArray(TArrayI &indexes, const std::vector<fastjet::PseudoJet> &array)
 {
-  static Float_t pt[9999] = {0};
-
   const Int_t n = (Int_t)array.size();
 
   if (n < 1)
     return kFALSE;
 
+  if (indexes.GetSize() < n) indexes.Set(n);
+  if (fSortedJetPts.GetSize() < n) fSortedJetPts.Set(n);
+
+  Float_t *pt = fSortedJetPts.GetArray();
   for (Int_t i = 0; i < n; i++)
     pt[i] = array[i].perp();
 
-  TMath::Sort(n, pt, indexes);
+  TMath::Sort(n, pt, indexes.GetArray());
 
   return kTRUE;
 }
@@ -368,10 +512,7 @@ Bool_t AliEmcalJetTask::GetSortedArray(Int_t indexes[], std::vector<fastjet::Pse
  */
 void AliEmcalJetTask::ExecOnce()
 {
-  if (fTrackEfficiency < 1.) {
-    if (gRandom) delete gRandom;
-    gRandom = new TRandom3(0);
-  }
+  if (fTrackEfficiency < 1.) fRandom.SetSeed(fRandomSeed);
 
   fJetsName = AliJetContainer::GenerateJetName(fJetType, fJetAlgo, fRecombScheme, fRadius, GetParticleContainer(0), GetClusterContainer(0), fJetsTag);
 
@@ -939,6 +1080,7 @@ Bool_t AliEmcalJetTask::IsJetInPhos(Double_t eta, Double_t phi, Double_t r)
  * @param minJetPt cut on the minimum jet pt
  * @param lockTask lock the task - no further changes are possible if kTRUE
  * @param bFillGhosts add ghosts particles among the jet constituents in the output
+ * @param bTimingInfo measure the CPU time of the jet finding steps, stored in the output container <name>_histos
  * @return a pointer to the new AliEmcalJetTask instance
  */
 AliEmcalJetTask* AliEmcalJetTask::AddTaskEmcalJet(
@@ -947,7 +1089,7 @@ AliEmcalJetTask* AliEmcalJetTask::AddTaskEmcalJet(
   const Double_t minTrPt, const Double_t minClPt,
   const Double_t ghostArea, const AliJetContainer::ERecoScheme_t reco,
   const TString tag, const Double_t minJetPt,
-  const Bool_t lockTask, const Bool_t bFillGhosts
+  const Bool_t lockTask, const Bool_t bFillGhosts, const Bool_t bTimingInfo
 )
 {
   // Get the pointer to the existing analysis manager via the static access method
@@ -1057,6 +1199,7 @@ AliEmcalJetTask* AliEmcalJetTask::AddTaskEmcalJet(
   jetTask->SetGhostArea(ghostArea);
 
   if (bFillGhosts) jetTask->SetFillGhost();
+  if (bTimingInfo) jetTask->SetTimingInfo();
   if (lockTask) jetTask->SetLocked();
 
   // Final settings, pass to manager and set the containers
@@ -1067,5 +1210,11 @@ AliEmcalJetTask* AliEmcalJetTask::AddTaskEmcalJet(
   AliAnalysisDataContainer* cinput = mgr->GetCommonInputContainer();
   mgr->ConnectInput(jetTask, 0, cinput);
 
+  if (bTimingInfo) {
+    AliAnalysisDataContainer* coutput = mgr->CreateContainer(Form("%s_histos", name.Data()), AliEmcalList::Class(),
+        AliAnalysisManager::kOutputContainer, AliAnalysisManager::GetCommonFileName());
+    mgr->ConnectOutput(jetTask, 1, coutput);
+  }
+
   return jetTask;
 }
@@ -5,10 +5,17 @@
  * See cxx source for full Copyright notice                               */
 
 class TClonesArray;
+class TH1;
 class TObjArray;
 class AliVEvent;
 class AliEmcalJetUtility;
 
+#include <TArrayF.h>
+#include <TArrayD.h>
+#include <TArrayI.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
+
 #include <AliLog.h>
 
 #include "AliAnalysisTaskEmcal.h"
@@ -61,7 +68,9 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask(const char *name);
   virtual ~AliEmcalJetTask();
 
+  void   UserCreateOutputObjects();
   Bool_t Run();
+  void   Terminate(Option_t *option);
 
   void                   SetGhostArea(Double_t gharea)              { if (IsLocked()) return; fGhostArea        = gharea; }
   void                   SetJetsName(const char *n)                 { if (IsLocked()) return; fJetsTag          = n     ; }
@@ -76,11 +85,13 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetRecombScheme(ERecoScheme_t scheme)      { if (IsLocked()) return; fRecombScheme     = scheme; }
   void                   SetTrackEfficiency(Double_t t)             { if (IsLocked()) return; fTrackEfficiency  = t     ; }
   void                   SetTrackEfficiencyOnlyForEmbedding(Bool_t b) { if (IsLocked()) return; fTrackEfficiencyOnlyForEmbedding = b     ; }
+  void                   SetRandomSeed(UInt_t s)                    { if (IsLocked()) return; fRandomSeed       = s     ; }
   void                   SetLegacyMode(Bool_t mode)                 { if (IsLocked()) return; fLegacyMode       = mode  ; }
   void                   SetFillGhost(Bool_t b=kTRUE)               { if (IsLocked()) return; fFillGhost        = b     ; }
   void                   SetRadius(Double_t r)                      { if (IsLocked()) return; fRadius           = r     ; }
 
   void                   SetEtaRange(Double_t emi, Double_t ema);
+  void                   SetTimingInfo(Bool_t b=kTRUE);
   void                   SetMinJetClusPt(Double_t min);
   void                   SetMinJetClusE(Double_t min);
   void                   SetMinJetTrackPt(Double_t min);
@@ -105,6 +116,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Int_t                  GetRecombScheme()                { return fRecombScheme      ; }
   Double_t               GetTrackEfficiency()             { return fTrackEfficiency   ; }
   Bool_t                 GetTrackEfficiencyOnlyForEmbedding() { return fTrackEfficiencyOnlyForEmbedding; }
+  UInt_t                 GetRandomSeed()                  { return fRandomSeed        ; }
 
   TClonesArray*          GetJets()                        { return fJets              ; }
   TObjArray*             GetUtilities()                   { return fUtilities         ; }
@@ -132,7 +144,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
       const TString tag                          = "Jet",
       const Double_t minJetPt                    = 0.,
       const Bool_t lockTask                      = kTRUE,
-      const Bool_t bFillGhosts                   = kFALSE
+      const Bool_t bFillGhosts                   = kFALSE,
+      const Bool_t bTimingInfo                   = kFALSE
     );
 
 #if !defined(__CINT__) && !defined(__MAKECINT__)
@@ -150,7 +163,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   PrepareUtilities();
   void                   ExecuteUtilities(AliEmcalJet* jet, Int_t ij);
   void                   TerminateUtilities();
-  Bool_t                 GetSortedArray(Int_t indexes[], std::vector<fastjet::PseudoJet> array) const;
+  Bool_t                 GetSortedArray(TArrayI &indexes, const std::vector<fastjet::PseudoJet> &array);
   Bool_t                 IsJetInEmcal(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInDcal(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInDcalOnly(Double_t eta, Double_t phi, Double_t r);
@@ -173,6 +186,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   TObjArray             *fUtilities;              // jet utilities (gen subtractor, constituent subtractor etc.)
   Bool_t                 fTrackEfficiencyOnlyForEmbedding; // Apply aritificial tracking inefficiency only for embedded tracks
   Bool_t                 fLocked;                 // true if lock is set
+  Bool_t                 fTimingInfo;             // measure the CPU time of input building, clustering and branch filling
+  UInt_t                 fRandomSeed;             // seed of the artificial tracking inefficiency (0: time based)
 
   TString                fJetsName;               //!name of jet collection
   Bool_t                 fIsInit;                 //!=true if already initialized
@@ -183,6 +198,20 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
 
   TClonesArray          *fJets;                   //!jet collection
   AliFJWrapper           fFastJetWrapper;         //!fastjet wrapper
+  TArrayI                fSortedJetIndexes;       //!indexes of the inclusive jets sorted by decreasing pt
+  TArrayF                fSortedJetPts;           //!pt of the inclusive jets, used for sorting
+  TRandom3               fRandom;                 //!random number generator for the artificial tracking inefficiency
+  TArrayD                fInputPx;                //!px of the jet finder input (all containers, in order)
+  TArrayD                fInputPy;                //!py of the jet finder input
+  TArrayD                fInputPz;                //!pz of the jet finder input
+  TArrayD                fInputE;                 //!energy of the jet finder input
+  TArrayI                fInputUid;               //!user index of the jet finder input
+  TStopwatch             fTimer;                  //!timer for the per-event timing information
+  Double_t               fTimeInput;              //!total CPU time spent building the input (s)
+  Double_t               fTimeClustering;         //!total CPU time spent in clustering, including the jet areas (s)
+  Double_t               fTimeBranch;             //!total CPU time spent filling the jet branch (s)
+  Int_t                  fNTimedEvents;           //!number of events included in the timing information
+  TH1                   *fHistTiming;             //!CPU time (s) of the jet finding steps and number of timed events, in the task output
 
   static const Int_t     fgkConstIndexShift;      //!contituent index shift
 
@@ -197,7 +226,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 24);
+  ClassDef(AliEmcalJetTask, 28);
   /// \endcond
 };
 #endif
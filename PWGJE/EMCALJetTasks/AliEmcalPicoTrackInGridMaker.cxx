@@ -410,7 +410,8 @@ Double_t AliEmcalPicoTrackInGridMaker::CalculateMedian(const Int_t patchType, co
   Int_t stepSize = GetTriggerPatchIdStepSizeNoOverlap(GetPatchDim(patchType),level);
   //Printf("patchType: %d dim: %d stepSizeNoOverlap: %d ",patchType,GetPatchDim(patchType),stepSize);
 
-  static Double_t arr[999];
+  if(fMedianBuffer.GetSize()<n) fMedianBuffer.Set(n);
+  Double_t *arr = fMedianBuffer.GetArray();
   Int_t c = 0;
 
   //find patch with highest energy
@@ -442,11 +443,11 @@ Double_t AliEmcalPicoTrackInGridMaker::CalculateMedian(const Int_t patchType, co
 	  c++;
 	}
 	if(type==0 && areaType==0) {
-	  fh1RhoEmcal[patchType]->Fill(arr[c-1]);
+	  if(c>0) fh1RhoEmcal[patchType]->Fill(arr[c-1]);
 	  fPatchEnVsActivityEmcal[patchType]->Fill(fPatchGrid[type][patchType].At(id),fActiveAreaCP[type][patchType].At(id));
 	}
 	if(type==1 && areaType==0) {
-	  fh1RhoDcal[patchType]->Fill(arr[c-1]);
+	  if(c>0) fh1RhoDcal[patchType]->Fill(arr[c-1]);
 	  fPatchEnVsActivityDcal[patchType]->Fill(fPatchGrid[type][patchType].At(id),fActiveAreaCP[type][patchType].At(id));
 	}
       }
@@ -9,7 +9,7 @@
 #include <TFile.h>
 #include <TMath.h>
 #include <TString.h>
-#include <TRandom.h>
+#include <TRandom3.h>
 #include <TParameter.h>
 #include <TH1I.h>
 #include <TGrid.h>
@@ -35,7 +35,9 @@ AliJetEmbeddingFromPYTHIATask::AliJetEmbeddingFromPYTHIATask() :
   fPtHardBinParam(0),
   fPtHardBinCount(0),
   fHistPtHardBins(0),
-  fDebugEmbedding(kFALSE)
+  fDebugEmbedding(kFALSE),
+  fPtHardBinOrder(),
+  fRandom()
 {
   // Default constructor.
   SetSuffix("PYTHIAEmbedding");
@@ -58,7 +60,9 @@ AliJetEmbeddingFromPYTHIATask::AliJetEmbeddingFromPYTHIATask(const char *name, B
   fPtHardBinParam(0),
   fPtHardBinCount(0),
   fHistPtHardBins(0),
-  fDebugEmbedding(kFALSE)
+  fDebugEmbedding(kFALSE),
+  fPtHardBinOrder(),
+  fRandom()
 {
   // Standard constructor.
   SetSuffix("PYTHIAEmbedding");
@@ -110,6 +114,8 @@ void AliJetEmbeddingFromPYTHIATask::UserCreateOutputObjects()
 //________________________________________________________________________
 Bool_t AliJetEmbeddingFromPYTHIATask::ExecOnce() 
 {
+  fRandom.SetSeed(0);
+
   if (fPtHardBinScaling.GetSize() > 0) {
     Double_t sum = 0;
     for (Int_t i = 0; i < fPtHardBinScaling.GetSize(); i++) 
@@ -161,12 +167,13 @@ Bool_t AliJetEmbeddingFromPYTHIATask::GetNextEntry()
 //________________________________________________________________________
 Int_t AliJetEmbeddingFromPYTHIATask::GetRandomPtHardBin() 
 {
-  static Int_t order[20]={-1};
-
-  if (order[0] == -1)
-    TMath::Sort(fPtHardBinScaling.GetSize(), fPtHardBinScaling.GetArray(), order);
+  if (fPtHardBinOrder.GetSize() != fPtHardBinScaling.GetSize()) {
+    fPtHardBinOrder.Set(fPtHardBinScaling.GetSize());
+    TMath::Sort(fPtHardBinScaling.GetSize(), fPtHardBinScaling.GetArray(), fPtHardBinOrder.GetArray());
+  }
+  const Int_t *order = fPtHardBinOrder.GetArray();
 
-  Double_t rnd = gRandom->Rndm();
+  Double_t rnd = fRandom.Rndm();
   Double_t sum = 0;
   Int_t ptHard = -1;
   for (Int_t i = 0; i < fPtHardBinScaling.GetSize(); i++) {
@@ -218,7 +225,7 @@ TFile* AliJetEmbeddingFromPYTHIATask::GetNextFile()
     }
   }
   else {
-    fCurrentAODFileID = TMath::Nint(gRandom->Rndm()*(fTotalFiles-1))+1;
+    fCurrentAODFileID = TMath::Nint(fRandom.Rndm()*(fTotalFiles-1))+1;
   }
 
   if (fMinEntriesPerPtHardBin < 0) {
@@ -8,6 +8,8 @@
 
 #include "AliJetEmbeddingFromAODTask.h"
 #include <TArrayD.h>
+#include <TArrayI.h>
+#include <TRandom3.h>
 
 template<class T> 
 class TParameter;
@@ -53,11 +55,13 @@ class AliJetEmbeddingFromPYTHIATask : public AliJetEmbeddingFromAODTask {
   Bool_t           fDebugEmbedding          ;// Debug embedding by embedding files in order. Do _not_ use on the grid! (It will embed the same files for each job)
 
   TH1             *fHistPtHardBins          ;//!Embeded pt hard bin distribution
+  TArrayI          fPtHardBinOrder          ;//!pt hard bins sorted by decreasing scaling
+  TRandom3         fRandom                  ;//!random number generator for the pt hard bin and file choice
 
  private:
   AliJetEmbeddingFromPYTHIATask(const AliJetEmbeddingFromPYTHIATask&);            // not implemented
   AliJetEmbeddingFromPYTHIATask &operator=(const AliJetEmbeddingFromPYTHIATask&); // not implemented
 
-  ClassDef(AliJetEmbeddingFromPYTHIATask, 4) // Jet embedding from PYTHIA task
+  ClassDef(AliJetEmbeddingFromPYTHIATask, 6) // Jet embedding from PYTHIA task
 };
 #endif
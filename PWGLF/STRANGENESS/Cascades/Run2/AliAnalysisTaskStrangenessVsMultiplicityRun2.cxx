@@ -63,6 +63,7 @@ class AliESDv0;
 class AliAODv0;
 
 #include <numeric>
+#include <vector>
 
 #include <Riostream.h>
 #include "TList.h"
@@ -122,6 +123,75 @@ class AliAODv0;
 using std::cout;
 using std::endl;
 
+//________________________________________________________________________
+// Superlight mode cut tables: the configurations of fListV0 / fListCascade
+// with one array per cut, so that a candidate is checked against all
+// configurations with one short loop per group of cuts. The cuts keep the
+// types in which the per-configuration selection used to compare them.
+//________________________________________________________________________
+class AliVarCosPACut {
+public:
+    // Variable (pt dependent) CosPA cut of the configurations using it
+    void Add( Int_t lcfg, Float_t p0, Float_t p1, Float_t p2, Float_t p3, Float_t p4 ) {
+        fConfig.push_back(lcfg);
+        fPar.push_back(p0); fPar.push_back(p1); fPar.push_back(p2); fPar.push_back(p3); fPar.push_back(p4);
+    }
+    // Set lCut to the variable cut where tighter than lFixedCut
+    void Apply( Float_t lPt, const std::vector<Float_t> &lFixedCut, std::vector<Float_t> &lCut ) const {
+        for(UInt_t i=0; i<fConfig.size(); i++){
+            const Float_t *p = &fPar[5*i];
+            Float_t lVarCosPA = TMath::Cos( p[0]*TMath::Exp(p[1]*lPt) + p[2]*TMath::Exp(p[3]*lPt) + p[4] );
+            const Int_t lcfg = fConfig[i];
+            lCut[lcfg] = lFixedCut[lcfg];
+            if( lVarCosPA > lCut[lcfg] ) lCut[lcfg] = lVarCosPA;
+        }
+    }
+    std::vector<Int_t>   fConfig; // configuration index
+    std::vector<Float_t> fPar;    // 5 parameters per configuration
+};
+
+class AliV0CutTable {
+public:
+    enum { kNHypo = 4 }; // AliV0Result::EMassHypo + none
+    std::vector<TH3F*>    fHisto;
+    std::vector<Int_t>    fHypo;
+    std::vector<Int_t>    fOnTheFly;
+    std::vector<Double_t> fMinEta, fMaxEta, fMinRap, fMaxRap;
+    std::vector<Double_t> fV0Radius, fDCANegToPV, fDCAPosToPV, fDCAV0Daughters;
+    std::vector<Double_t> fProperLifetime, fLeastCR, fLeastCROverFindable;
+    std::vector<UChar_t>  fBaryonMomentum;      // baryon momentum cut applies (not K0Short)
+    std::vector<Double_t> fMinBaryonMomentum, fTPCdEdx;
+    std::vector<UChar_t>  fArmenteros;          // Armenteros cut applies (K0Short only)
+    std::vector<Double_t> fArmenterosParameter;
+    std::vector<UChar_t>  fITSRefit;
+    std::vector<Double_t> fMaxChi2PerCluster, fMinTrackLength;
+    std::vector<Float_t>  fV0CosPA;
+    AliVarCosPACut        fVarV0CosPA;
+    std::vector<Float_t>  fV0CosPACut;          // per candidate
+    std::vector<UChar_t>  fPass;                // per candidate
+};
+
+class AliCascadeCutTable {
+public:
+    enum { kNHypo = 5 }; // AliCascadeResult::EMassHypo + none
+    std::vector<TH3F*>    fHisto;
+    std::vector<Int_t>    fHypo;
+    std::vector<Int_t>    fCharge;
+    std::vector<Double_t> fMinEta, fMaxEta, fMinRap, fMaxRap;
+    std::vector<Double_t> fDCANegToPV, fDCAPosToPV, fDCAV0Daughters, fV0Radius;
+    std::vector<Double_t> fDCAV0ToPV, fV0Mass, fDCABachToPV, fDCACascDaughters, fCascRadius;
+    std::vector<Double_t> fV0MassSigma, fProperLifetime, fLeastClusters, fTPCdEdx;
+    std::vector<UChar_t>  fXiRejection;         // Xi rejection applies (Omega only)
+    std::vector<Double_t> fXiRejectionCut, fDCABachToBaryon, fMinV0Lifetime, fMaxV0Lifetime;
+    std::vector<UChar_t>  fITSRefit;
+    std::vector<Double_t> fMaxChi2PerCluster, fMinTrackLength;
+    std::vector<UChar_t>  f276TeVV0CosPA;
+    std::vector<Float_t>  fCascCosPA, fV0CosPA, fBBCosPA;
+    AliVarCosPACut        fVarCascCosPA, fVarV0CosPA, fVarBBCosPA;
+    std::vector<Float_t>  fCascCosPACut, fV0CosPACut, fBBCosPACut; // per candidate
+    std::vector<UChar_t>  fPass;                // per candidate
+};
+
 ClassImp(AliAnalysisTaskStrangenessVsMultiplicityRun2)
 
 AliAnalysisTaskStrangenessVsMultiplicityRun2::AliAnalysisTaskStrangenessVsMultiplicityRun2()
@@ -323,7 +393,9 @@ fTreeCascVarNegIsKink(kFALSE),
 fkSelectCharge(0),
 //Histos
 fHistEventCounter(0),
-fHistCentrality(0)
+fHistCentrality(0),
+fV0CutTable(0),
+fCascadeCutTable(0)
 //------------------------------------------------
 // Tree Variables
 {
@@ -528,7 +600,9 @@ fTreeCascVarNegIsKink(kFALSE),
 fkSelectCharge(0),
 //Histos
 fHistEventCounter(0),
-fHistCentrality(0)
+fHistCentrality(0),
+fV0CutTable(0),
+fCascadeCutTable(0)
 {
 
     //Re-vertex: Will only apply for cascade candidates
@@ -630,6 +704,8 @@ AliAnalysisTaskStrangenessVsMultiplicityRun2::~AliAnalysisTaskStrangenessVsMulti
         delete fRand;
         fRand = 0x0;
     }
+    delete fV0CutTable;
+    delete fCascadeCutTable;
 }
 
 //________________________________________________________________________
@@ -1406,116 +1482,70 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         // Superlight adaptive output mode
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
-        //Step 1: Sweep members of the output object TList and fill all of them as appropriate
-        Int_t lNumberOfConfigurations = fListV0->GetEntries();
-        //AliWarning(Form("[V0 Analyses] Processing different configurations (%i detected)",lNumberOfConfigurations));
-        TH3F *histoout         = 0x0;
-        AliV0Result *lV0Result = 0x0;
+        //Step 1: Check the candidate against all configurations at once (cut table compiled from fListV0)
+        if( !fV0CutTable || (Int_t)fV0CutTable->fHisto.size() != fListV0->GetEntries() ) CompileV0CutTable();
+        AliV0CutTable &lV0Cuts = *fV0CutTable;
+        const Int_t lNumberOfConfigurations = lV0Cuts.fHisto.size();
+
+        //Candidate properties per mass hypothesis: K0Short, Lambda, AntiLambda, none
+        const Float_t lHypoMass[AliV0CutTable::kNHypo]    = { fTreeVariableInvMassK0s, fTreeVariableInvMassLambda, fTreeVariableInvMassAntiLambda, 0 };
+        const Float_t lHypoRap[AliV0CutTable::kNHypo]     = { fTreeVariableRapK0Short, fTreeVariableRapLambda, fTreeVariableRapLambda, 0 };
+        const Float_t lHypoPDGMass[AliV0CutTable::kNHypo] = { 0.497, 1.115683, 1.115683, -1 };
+        const Float_t lHypoNegdEdx[AliV0CutTable::kNHypo] = { fTreeVariableNSigmasNegPion, fTreeVariableNSigmasNegPion, fTreeVariableNSigmasNegProton, 100 };
+        const Float_t lHypoPosdEdx[AliV0CutTable::kNHypo] = { fTreeVariableNSigmasPosPion, fTreeVariableNSigmasPosProton, fTreeVariableNSigmasPosPion, 100 };
+        const Float_t lHypoBaryonMomentum[AliV0CutTable::kNHypo] = { -0.5, fTreeVariablePosInnerP, fTreeVariableNegInnerP, -0.5 };
+        Float_t lHypoLifetime[AliV0CutTable::kNHypo], lHypoAbsNegdEdx[AliV0CutTable::kNHypo], lHypoAbsPosdEdx[AliV0CutTable::kNHypo];
+        for(Int_t ih=0; ih<AliV0CutTable::kNHypo; ih++){
+            lHypoLifetime[ih]   = fTreeVariableDistOverTotMom*lHypoPDGMass[ih];
+            lHypoAbsNegdEdx[ih] = TMath::Abs(lHypoNegdEdx[ih]);
+            lHypoAbsPosdEdx[ih] = TMath::Abs(lHypoPosdEdx[ih]);
+        }
+        const Float_t lAbsAlphaV0 = TMath::Abs(fTreeVariableAlphaV0);
+        const Bool_t lITSRefit = (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) && (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit);
+
+        //Variable V0 CosPA, only if tighter than the non-variable cut
+        lV0Cuts.fVarV0CosPA.Apply( fTreeVariablePt, lV0Cuts.fV0CosPA, lV0Cuts.fV0CosPACut );
+
         for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
-            lV0Result = (AliV0Result*) fListV0->At(lcfg);
-            histoout  = lV0Result->GetHistogram();
-
-            Float_t lMass = 0;
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBaryonMomentum = -0.5;
-
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lV0Result -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
-                                             lVarV0CosPApar[4]);
-            if( lV0Result->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
-
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short     ){
-                lMass    = fTreeVariableInvMassK0s;
-                lRap     = fTreeVariableRapK0Short;
-                lPDGMass = 0.497;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-            }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda      ){
-                lMass = fTreeVariableInvMassLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosProton;
-                lBaryonMomentum = fTreeVariablePosInnerP;
-            }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda  ){
-                lMass = fTreeVariableInvMassAntiLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegProton;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-                lBaryonMomentum = fTreeVariableNegInnerP;
-            }
+            lV0Cuts.fPass[lcfg] =
+            //Check 1: Offline Vertexer
+            ( lOnFlyStatus == lV0Cuts.fOnTheFly[lcfg] ) &
+            //Check 2: Basic Acceptance cuts (tracks)
+            ( lV0Cuts.fMinEta[lcfg] < fTreeVariableNegEta ) & ( fTreeVariableNegEta < lV0Cuts.fMaxEta[lcfg] ) &
+            ( lV0Cuts.fMinEta[lcfg] < fTreeVariablePosEta ) & ( fTreeVariablePosEta < lV0Cuts.fMaxEta[lcfg] ) &
+            //Check 3: Topological Variables
+            ( fTreeVariableV0Radius > lV0Cuts.fV0Radius[lcfg] ) &
+            ( fTreeVariableDcaNegToPrimVertex > lV0Cuts.fDCANegToPV[lcfg] ) &
+            ( fTreeVariableDcaPosToPrimVertex > lV0Cuts.fDCAPosToPV[lcfg] ) &
+            ( fTreeVariableDcaV0Daughters < lV0Cuts.fDCAV0Daughters[lcfg] ) &
+            ( fTreeVariableV0CosineOfPointingAngle > lV0Cuts.fV0CosPACut[lcfg] ) &
+            ( fTreeVariableLeastNbrCrossedRows > lV0Cuts.fLeastCR[lcfg] ) &
+            ( fTreeVariableLeastRatioCrossedRowsOverFindable > lV0Cuts.fLeastCROverFindable[lcfg] ) &
+            //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
+            ( !lV0Cuts.fArmenteros[lcfg] | ( fTreeVariablePtArmV0 > lV0Cuts.fArmenterosParameter[lcfg]*lAbsAlphaV0 ) ) &
+            //Check 7: kITSrefit track selection if requested
+            ( lITSRefit | !lV0Cuts.fITSRefit[lcfg] ) &
+            //Check 8: Max Chi2/Clusters if not absurd
+            ( ( lV0Cuts.fMaxChi2PerCluster[lcfg] > 1e+3 ) | ( fTreeVariableMaxChi2PerCluster < lV0Cuts.fMaxChi2PerCluster[lcfg] ) ) &
+            //Check 9: Min Track Length if positive
+            ( ( lV0Cuts.fMinTrackLength[lcfg] < 0 ) | ( fTreeVariableMinTrackLength > lV0Cuts.fMinTrackLength[lcfg] ) );
+        }
+        for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+            const Int_t ih = lV0Cuts.fHypo[lcfg];
+            lV0Cuts.fPass[lcfg] &=
+            //Check 2: Basic Acceptance cuts (rapidity)
+            ( lHypoRap[ih] > lV0Cuts.fMinRap[lcfg] ) & ( lHypoRap[ih] < lV0Cuts.fMaxRap[lcfg] ) &
+            //Check 3: Proper lifetime
+            ( lHypoLifetime[ih] < lV0Cuts.fProperLifetime[lcfg] ) &
+            //Check 4: Minimum momentum of baryon daughter
+            ( !lV0Cuts.fBaryonMomentum[lcfg] | ( lHypoBaryonMomentum[ih] > lV0Cuts.fMinBaryonMomentum[lcfg] ) ) &
+            //Check 5: TPC dEdx selections
+            ( lHypoAbsNegdEdx[ih] < lV0Cuts.fTPCdEdx[lcfg] ) & ( lHypoAbsPosdEdx[ih] < lV0Cuts.fTPCdEdx[lcfg] );
+        }
 
-            if (
-                //Check 1: Offline Vertexer
-                lOnFlyStatus == lV0Result->GetUseOnTheFly() &&
-
-                //Check 2: Basic Acceptance cuts
-                lV0Result->GetCutMinEtaTracks() < fTreeVariableNegEta && fTreeVariableNegEta < lV0Result->GetCutMaxEtaTracks() &&
-                lV0Result->GetCutMinEtaTracks() < fTreeVariablePosEta && fTreeVariablePosEta < lV0Result->GetCutMaxEtaTracks() &&
-                lRap > lV0Result->GetCutMinRapidity() &&
-                lRap < lV0Result->GetCutMaxRapidity() &&
-                
-                //Check 3: Topological Variables
-                fTreeVariableV0Radius > lV0Result->GetCutV0Radius() &&
-                fTreeVariableDcaNegToPrimVertex > lV0Result->GetCutDCANegToPV() &&
-                fTreeVariableDcaPosToPrimVertex > lV0Result->GetCutDCAPosToPV() &&
-                fTreeVariableDcaV0Daughters < lV0Result->GetCutDCAV0Daughters() &&
-                fTreeVariableV0CosineOfPointingAngle > lV0CosPACut &&
-                fTreeVariableDistOverTotMom*lPDGMass < lV0Result->GetCutProperLifetime() &&
-                fTreeVariableLeastNbrCrossedRows > lV0Result->GetCutLeastNumberOfCrossedRows() &&
-                fTreeVariableLeastRatioCrossedRowsOverFindable > lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() &&
-
-                //Check 4: Minimum momentum of baryon daughter
-                ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short || lBaryonMomentum > lV0Result->GetCutMinBaryonMomentum() ) &&
-
-                //Check 5: TPC dEdx selections
-                TMath::Abs(lNegdEdx)<lV0Result->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx)<lV0Result->GetCutTPCdEdx() &&
-
-                //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
-                ( ( lV0Result->GetCutArmenteros() == kFALSE || lV0Result->GetMassHypothesis() != AliV0Result::kK0Short ) || ( fTreeVariablePtArmV0>lV0Result->GetCutArmenterosParameter()*TMath::Abs(fTreeVariableAlphaV0) ) ) &&
-
-                //Check 7: kITSrefit track selection if requested
-                (
-                 ( (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit) )
-                 ||
-                 !lV0Result->GetCutUseITSRefitTracks()
-                 )&&
-
-                //Check 8: Max Chi2/Clusters if not absurd
-                ( lV0Result->GetCutMaxChi2PerCluster()>1e+3 ||
-                 fTreeVariableMaxChi2PerCluster < lV0Result->GetCutMaxChi2PerCluster()
-                 ) &&
-                //Check 9: Min Track Length if positive
-                ( lV0Result->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()
-                 )
-                )
-            {
-                //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeVariablePt, lMass );
-            }
+        //Step 2: Fill the histograms of the configurations satisfying all conditionals
+        for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+            if( lV0Cuts.fPass[lcfg] ) lV0Cuts.fHisto[lcfg] -> Fill ( fCentrality, fTreeVariablePt, lHypoMass[lV0Cuts.fHypo[lcfg]] );
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         // End Superlight adaptive output mode
@@ -2180,253 +2210,122 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         // Superlight adaptive output mode
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
-        //Step 1: Sweep members of the output object TList and fill all of them as appropriate
-        Int_t lNumberOfConfigurationsCascade = fListCascade->GetEntries();
-        //AliWarning(Form("[Cascade Analyses] Processing different configurations (%i detected)",lNumberOfConfigurationsCascade));
-        TH3F *histoout         = 0x0;
-        AliCascadeResult *lCascadeResult = 0x0;
+        //Step 1: Check the candidate against all configurations at once (cut table compiled from fListCascade)
+        if( !fCascadeCutTable || (Int_t)fCascadeCutTable->fHisto.size() != fListCascade->GetEntries() ) CompileCascadeCutTable();
+        AliCascadeCutTable &lCascCuts = *fCascadeCutTable;
+        const Int_t lNumberOfConfigurationsCascade = lCascCuts.fHisto.size();
+
+        //For parametric V0 Mass selection
+        Float_t lExpV0Mass =
+        fLambdaMassMean[0]+
+        fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
+        fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
+
+        Float_t lExpV0Sigma =
+        fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
+        fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
+
+        //========================================================================
+        //For 2.76TeV-like parametric V0 CosPA
+        Float_t l276TeVV0CosPA = 0.998;
+        Float_t pThr=1.5;
+        if (lV0TotMomentum<pThr) {
+            //Below the threshold "pThr", try a momentum dependent cos(PA) cut
+            const Double_t bend=0.03; // approximate Xi bending angle
+            const Double_t qt=0.211;  // max Lambda pT in Omega decay
+            const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
+            Double_t
+            cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
+            l276TeVV0CosPA = cpaCut;
+        }
+        //========================================================================
+
+        //Candidate properties per mass hypothesis: XiMinus, XiPlus, OmegaMinus, OmegaPlus, none
+        const Float_t lHypoMass[AliCascadeCutTable::kNHypo]     = { fTreeCascVarMassAsXi, fTreeCascVarMassAsXi, fTreeCascVarMassAsOmega, fTreeCascVarMassAsOmega, 0 };
+        const Float_t lHypoV0Mass[AliCascadeCutTable::kNHypo]   = { fTreeCascVarV0MassLambda, fTreeCascVarV0MassAntiLambda, fTreeCascVarV0MassLambda, fTreeCascVarV0MassAntiLambda, 0 };
+        const Float_t lHypoRap[AliCascadeCutTable::kNHypo]      = { fTreeCascVarRapXi, fTreeCascVarRapXi, fTreeCascVarRapOmega, fTreeCascVarRapOmega, 0 };
+        const Float_t lHypoPDGMass[AliCascadeCutTable::kNHypo]  = { 1.32171, 1.32171, 1.67245, 1.67245, -1 };
+        const Float_t lHypoNegdEdx[AliCascadeCutTable::kNHypo]  = { fTreeCascVarNegNSigmaPion, fTreeCascVarNegNSigmaProton, fTreeCascVarNegNSigmaPion, fTreeCascVarNegNSigmaProton, 100 };
+        const Float_t lHypoPosdEdx[AliCascadeCutTable::kNHypo]  = { fTreeCascVarPosNSigmaProton, fTreeCascVarPosNSigmaPion, fTreeCascVarPosNSigmaProton, fTreeCascVarPosNSigmaPion, 100 };
+        const Float_t lHypoBachdEdx[AliCascadeCutTable::kNHypo] = { fTreeCascVarBachNSigmaPion, fTreeCascVarBachNSigmaPion, fTreeCascVarBachNSigmaKaon, fTreeCascVarBachNSigmaKaon, 100 };
+        Double_t lHypoV0MassWindow[AliCascadeCutTable::kNHypo];
+        Float_t lHypoV0MassNSigma[AliCascadeCutTable::kNHypo], lHypoLifetime[AliCascadeCutTable::kNHypo];
+        Float_t lHypoAbsNegdEdx[AliCascadeCutTable::kNHypo], lHypoAbsPosdEdx[AliCascadeCutTable::kNHypo], lHypoAbsBachdEdx[AliCascadeCutTable::kNHypo];
+        for(Int_t ih=0; ih<AliCascadeCutTable::kNHypo; ih++){
+            lHypoV0MassWindow[ih] = TMath::Abs(lHypoV0Mass[ih]-1.116);
+            lHypoV0MassNSigma[ih] = TMath::Abs( (lHypoV0Mass[ih]-lExpV0Mass) / lExpV0Sigma );
+            lHypoLifetime[ih]     = fTreeCascVarDistOverTotMom*lHypoPDGMass[ih];
+            lHypoAbsNegdEdx[ih]   = TMath::Abs(lHypoNegdEdx[ih]);
+            lHypoAbsPosdEdx[ih]   = TMath::Abs(lHypoPosdEdx[ih]);
+            lHypoAbsBachdEdx[ih]  = TMath::Abs(lHypoBachdEdx[ih]);
+        }
+        const Double_t lXiMassWindow = TMath::Abs( fTreeCascVarMassAsXi - 1.32171 );
+        const Bool_t lITSRefit = (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) && (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) && (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit);
+
+        //Variable Cascade and V0 CosPA (only if tighter than the non-variable cut)
+        //and Bach-Baryon CosPA (only if looser, WARNING: BEWARE INVERSE LOGIC)
+        lCascCuts.fVarCascCosPA.Apply( fTreeCascVarPt, lCascCuts.fCascCosPA, lCascCuts.fCascCosPACut );
+        lCascCuts.fVarV0CosPA  .Apply( fTreeCascVarPt, lCascCuts.fV0CosPA,   lCascCuts.fV0CosPACut   );
+        lCascCuts.fVarBBCosPA  .Apply( fTreeCascVarPt, lCascCuts.fBBCosPA,   lCascCuts.fBBCosPACut   );
+
         for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
-            lCascadeResult = (AliCascadeResult*) fListCascade->At(lcfg);
-            histoout  = lCascadeResult->GetHistogram();
-
-            Float_t lMass = 0;
-            Float_t lV0Mass = 0; 
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBachdEdx = 100;
-            Short_t  lCharge = -2;
-            Int_t lChargePos =  1;
-            Int_t lChargeNeg = -1;
-            Float_t lprpx, lprpy, lprpz, lpipx, lpipy, lpipz;
-            lpipx = fTreeCascVarBachPx;
-            lpipy = fTreeCascVarBachPy;
-            lpipz = fTreeCascVarBachPz;
-
-            //For parametric V0 Mass selection
-            Float_t lExpV0Mass =
-            fLambdaMassMean[0]+
-            fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
-            fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
-
-            Float_t lExpV0Sigma =
-            fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
-            fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
-            
-            //========================================================================
-            //For 2.76TeV-like parametric V0 CosPA
-            Float_t l276TeVV0CosPA = 0.998;
-            Float_t pThr=1.5;
-            if (lV0TotMomentum<pThr) {
-                //Below the threshold "pThr", try a momentum dependent cos(PA) cut
-                const Double_t bend=0.03; // approximate Xi bending angle
-                const Double_t qt=0.211;  // max Lambda pT in Omega decay
-                const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
-                Double_t
-                cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
-                l276TeVV0CosPA = cpaCut;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable Cascade CosPA
-            Float_t lCascCosPACut = lCascadeResult -> GetCutCascCosPA();
-            Float_t lVarCascCosPApar[5];
-            lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
-            lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
-            lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
-            lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
-            lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
-            Float_t lVarCascCosPA = TMath::Cos(
-                lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
-                lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
-                lVarCascCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarCascCosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
-            }
-            //========================================================================
-
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lCascadeResult -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                               lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
-                                               lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
-                                               lVarV0CosPApar[4]);
-            if( lCascadeResult->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
-
-            //========================================================================
-            //Setting up: Variable BB CosPA
-            Float_t lBBCosPACut = lCascadeResult -> GetCutBachBaryonCosPA();
-            Float_t lVarBBCosPApar[5];
-            lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
-            lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
-            lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
-            lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
-            lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
-            Float_t lVarBBCosPA = TMath::Cos(
-                                             lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarBBCosPA() ){
-                //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
-                if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
-            }
-            //========================================================================
-
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
-            }
-            
-            if (
-                //Check 1: Charge consistent with expectations
-                fTreeCascVarCharge == lCharge &&
-                
-                //Check 2: Basic Acceptance cuts
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarPosEta && fTreeCascVarPosEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarNegEta && fTreeCascVarNegEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarBachEta && fTreeCascVarBachEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lRap > lCascadeResult->GetCutMinRapidity() &&
-                lRap < lCascadeResult->GetCutMaxRapidity() &&
-                
-                //Check 3: Topological Variables
-                // - V0 Selections
-                fTreeCascVarDCANegToPrimVtx > lCascadeResult->GetCutDCANegToPV() &&
-                fTreeCascVarDCAPosToPrimVtx > lCascadeResult->GetCutDCAPosToPV() &&
-                fTreeCascVarDCAV0Daughters < lCascadeResult->GetCutDCAV0Daughters() &&
-                fTreeCascVarV0CosPointingAngle > lV0CosPACut &&
-                fTreeCascVarV0Radius > lCascadeResult->GetCutV0Radius() &&
-                // - Cascade Selections
-                fTreeCascVarDCAV0ToPrimVtx > lCascadeResult->GetCutDCAV0ToPV() &&
-                TMath::Abs(lV0Mass-1.116) < lCascadeResult->GetCutV0Mass() &&
-                fTreeCascVarDCABachToPrimVtx > lCascadeResult->GetCutDCABachToPV() &&
-                fTreeCascVarDCACascDaughters < lCascadeResult->GetCutDCACascDaughters() &&
-                fTreeCascVarCascCosPointingAngle > lCascCosPACut &&
-                fTreeCascVarCascRadius > lCascadeResult->GetCutCascRadius() &&
-                
-                // - Implementation of a parametric V0 Mass cut if requested
-                (
-                 ( lCascadeResult->GetCutV0MassSigma() > 50 ) || //anything goes
-                 (TMath::Abs( (lV0Mass-lExpV0Mass) / lExpV0Sigma ) < lCascadeResult->GetCutV0MassSigma() )
-                 ) &&
-                
-                // - Miscellaneous
-                fTreeCascVarDistOverTotMom*lPDGMass < lCascadeResult->GetCutProperLifetime() &&
-                fTreeCascVarLeastNbrClusters > lCascadeResult->GetCutLeastNumberOfClusters() &&
-                
-                //Check 4: TPC dEdx selections
-                TMath::Abs(lNegdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lBachdEdx)<lCascadeResult->GetCutTPCdEdx() &&
-                
-                //Check 5: Xi rejection for Omega analysis
-                ( ( lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaMinus && lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaPlus  ) || ( TMath::Abs( fTreeCascVarMassAsXi - 1.32171 ) > lCascadeResult->GetCutXiRejection() ) ) &&
-                
-                //Check 6: Experimental DCA Bachelor to Baryon cut
-                ( fTreeCascVarDCABachToBaryon > lCascadeResult->GetCutDCABachToBaryon() ) &&
-                
-                //Check 7: Experimental Bach Baryon CosPA
-                ( fTreeCascVarWrongCosPA < lBBCosPACut  ) &&
-                
-                //Check 8: Min/Max V0 Lifetime cut
-                ( ( fTreeCascVarV0Lifetime > lCascadeResult->GetCutMinV0Lifetime() ) &&
-                 ( fTreeCascVarV0Lifetime < lCascadeResult->GetCutMaxV0Lifetime() ||
-                  lCascadeResult->GetCutMaxV0Lifetime() > 1e+3 ) ) &&
-                
-                //Check 9: kITSrefit track selection if requested
-                (
-                 ( (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit)
-                  )
-                 ||
-                 !lCascadeResult->GetCutUseITSRefitTracks()
-                 ) &&
-                
-                //Check 10: Max Chi2/Clusters if not absurd
-                ( lCascadeResult->GetCutMaxChi2PerCluster()>1e+3 ||
-                 fTreeCascVarMaxChi2PerCluster < lCascadeResult->GetCutMaxChi2PerCluster()
-                 )&&
-                
-                //Check 11: Min Track Length if positive
-                ( lCascadeResult->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength()
-                 )&&
-                
-                //Check 12: Check if special V0 CosPA cut used
-                //either don't use the cut at all, or make sure it's above threshold
-                ( lCascadeResult->GetCutUse276TeVV0CosPA()==kFALSE ||
-                 fTreeCascVarV0CosPointingAngle>l276TeVV0CosPA
-                 )
-                ){
-                //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeCascVarPt, lMass );
-            }
+            lCascCuts.fPass[lcfg] =
+            //Check 1: Charge consistent with expectations
+            ( fTreeCascVarCharge == lCascCuts.fCharge[lcfg] ) &
+            //Check 2: Basic Acceptance cuts (tracks)
+            ( lCascCuts.fMinEta[lcfg] < fTreeCascVarPosEta ) & ( fTreeCascVarPosEta < lCascCuts.fMaxEta[lcfg] ) &
+            ( lCascCuts.fMinEta[lcfg] < fTreeCascVarNegEta ) & ( fTreeCascVarNegEta < lCascCuts.fMaxEta[lcfg] ) &
+            ( lCascCuts.fMinEta[lcfg] < fTreeCascVarBachEta ) & ( fTreeCascVarBachEta < lCascCuts.fMaxEta[lcfg] ) &
+            //Check 3: Topological Variables
+            // - V0 Selections
+            ( fTreeCascVarDCANegToPrimVtx > lCascCuts.fDCANegToPV[lcfg] ) &
+            ( fTreeCascVarDCAPosToPrimVtx > lCascCuts.fDCAPosToPV[lcfg] ) &
+            ( fTreeCascVarDCAV0Daughters < lCascCuts.fDCAV0Daughters[lcfg] ) &
+            ( fTreeCascVarV0CosPointingAngle > lCascCuts.fV0CosPACut[lcfg] ) &
+            ( fTreeCascVarV0Radius > lCascCuts.fV0Radius[lcfg] ) &
+            // - Cascade Selections
+            ( fTreeCascVarDCAV0ToPrimVtx > lCascCuts.fDCAV0ToPV[lcfg] ) &
+            ( fTreeCascVarDCABachToPrimVtx > lCascCuts.fDCABachToPV[lcfg] ) &
+            ( fTreeCascVarDCACascDaughters < lCascCuts.fDCACascDaughters[lcfg] ) &
+            ( fTreeCascVarCascCosPointingAngle > lCascCuts.fCascCosPACut[lcfg] ) &
+            ( fTreeCascVarCascRadius > lCascCuts.fCascRadius[lcfg] ) &
+            // - Miscellaneous
+            ( fTreeCascVarLeastNbrClusters > lCascCuts.fLeastClusters[lcfg] ) &
+            //Check 5: Xi rejection for Omega analysis
+            ( !lCascCuts.fXiRejection[lcfg] | ( lXiMassWindow > lCascCuts.fXiRejectionCut[lcfg] ) ) &
+            //Check 6: Experimental DCA Bachelor to Baryon cut
+            ( fTreeCascVarDCABachToBaryon > lCascCuts.fDCABachToBaryon[lcfg] ) &
+            //Check 7: Experimental Bach Baryon CosPA
+            ( fTreeCascVarWrongCosPA < lCascCuts.fBBCosPACut[lcfg] ) &
+            //Check 8: Min/Max V0 Lifetime cut
+            ( fTreeCascVarV0Lifetime > lCascCuts.fMinV0Lifetime[lcfg] ) &
+            ( ( fTreeCascVarV0Lifetime < lCascCuts.fMaxV0Lifetime[lcfg] ) | ( lCascCuts.fMaxV0Lifetime[lcfg] > 1e+3 ) ) &
+            //Check 9: kITSrefit track selection if requested
+            ( lITSRefit | !lCascCuts.fITSRefit[lcfg] ) &
+            //Check 10: Max Chi2/Clusters if not absurd
+            ( ( lCascCuts.fMaxChi2PerCluster[lcfg] > 1e+3 ) | ( fTreeCascVarMaxChi2PerCluster < lCascCuts.fMaxChi2PerCluster[lcfg] ) ) &
+            //Check 11: Min Track Length if positive
+            ( ( lCascCuts.fMinTrackLength[lcfg] < 0 ) | ( fTreeCascVarMinTrackLength > lCascCuts.fMinTrackLength[lcfg] ) ) &
+            //Check 12: Check if special V0 CosPA cut used
+            ( !lCascCuts.f276TeVV0CosPA[lcfg] | ( fTreeCascVarV0CosPointingAngle > l276TeVV0CosPA ) );
+        }
+        for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
+            const Int_t ih = lCascCuts.fHypo[lcfg];
+            lCascCuts.fPass[lcfg] &=
+            //Check 2: Basic Acceptance cuts (rapidity)
+            ( lHypoRap[ih] > lCascCuts.fMinRap[lcfg] ) & ( lHypoRap[ih] < lCascCuts.fMaxRap[lcfg] ) &
+            //Check 3: V0 mass window, parametric V0 Mass cut if requested, proper lifetime
+            ( lHypoV0MassWindow[ih] < lCascCuts.fV0Mass[lcfg] ) &
+            ( ( lCascCuts.fV0MassSigma[lcfg] > 50 ) | ( lHypoV0MassNSigma[ih] < lCascCuts.fV0MassSigma[lcfg] ) ) &
+            ( lHypoLifetime[ih] < lCascCuts.fProperLifetime[lcfg] ) &
+            //Check 4: TPC dEdx selections
+            ( lHypoAbsNegdEdx[ih] < lCascCuts.fTPCdEdx[lcfg] ) & ( lHypoAbsPosdEdx[ih] < lCascCuts.fTPCdEdx[lcfg] ) &
+            ( lHypoAbsBachdEdx[ih] < lCascCuts.fTPCdEdx[lcfg] );
+        }
+
+        //Step 2: Fill the histograms of the configurations satisfying all conditionals
+        for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
+            if( lCascCuts.fPass[lcfg] ) lCascCuts.fHisto[lcfg] -> Fill ( fCentrality, fTreeCascVarPt, lHypoMass[lCascCuts.fHypo[lcfg]] );
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         // End Superlight adaptive output mode
@@ -2504,6 +2403,128 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddConfiguration( AliCascadeR
     fListCascade->Add(lCascadeResult);
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::CompileV0CutTable()
+{
+    //Copy the cuts of the configurations in fListV0 into the cut table
+    //used in UserExec, one array per cut
+    delete fV0CutTable;
+    fV0CutTable = new AliV0CutTable();
+    AliV0CutTable &lCuts = *fV0CutTable;
+    const Int_t lNumberOfConfigurations = fListV0->GetEntries();
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+        AliV0Result *lV0Result = (AliV0Result*) fListV0->At(lcfg);
+        Int_t lHypo = 3; //none
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short    ) lHypo = 0;
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda     ) lHypo = 1;
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda ) lHypo = 2;
+
+        lCuts.fHisto.push_back( lV0Result->GetHistogram() );
+        lCuts.fHypo.push_back( lHypo );
+        lCuts.fOnTheFly.push_back( lV0Result->GetUseOnTheFly() );
+        lCuts.fMinEta.push_back( lV0Result->GetCutMinEtaTracks() );
+        lCuts.fMaxEta.push_back( lV0Result->GetCutMaxEtaTracks() );
+        lCuts.fMinRap.push_back( lV0Result->GetCutMinRapidity() );
+        lCuts.fMaxRap.push_back( lV0Result->GetCutMaxRapidity() );
+        lCuts.fV0Radius.push_back( lV0Result->GetCutV0Radius() );
+        lCuts.fDCANegToPV.push_back( lV0Result->GetCutDCANegToPV() );
+        lCuts.fDCAPosToPV.push_back( lV0Result->GetCutDCAPosToPV() );
+        lCuts.fDCAV0Daughters.push_back( lV0Result->GetCutDCAV0Daughters() );
+        lCuts.fProperLifetime.push_back( lV0Result->GetCutProperLifetime() );
+        lCuts.fLeastCR.push_back( lV0Result->GetCutLeastNumberOfCrossedRows() );
+        lCuts.fLeastCROverFindable.push_back( lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() );
+        lCuts.fBaryonMomentum.push_back( lV0Result->GetMassHypothesis() != AliV0Result::kK0Short );
+        lCuts.fMinBaryonMomentum.push_back( lV0Result->GetCutMinBaryonMomentum() );
+        lCuts.fTPCdEdx.push_back( lV0Result->GetCutTPCdEdx() );
+        lCuts.fArmenteros.push_back( lV0Result->GetCutArmenteros() && lV0Result->GetMassHypothesis() == AliV0Result::kK0Short );
+        lCuts.fArmenterosParameter.push_back( lV0Result->GetCutArmenterosParameter() );
+        lCuts.fITSRefit.push_back( lV0Result->GetCutUseITSRefitTracks() );
+        lCuts.fMaxChi2PerCluster.push_back( lV0Result->GetCutMaxChi2PerCluster() );
+        lCuts.fMinTrackLength.push_back( lV0Result->GetCutMinTrackLength() );
+        lCuts.fV0CosPA.push_back( lV0Result->GetCutV0CosPA() );
+        if( lV0Result->GetCutUseVarV0CosPA() )
+            lCuts.fVarV0CosPA.Add( lcfg,
+                                  lV0Result->GetCutVarV0CosPAExp0Const(), lV0Result->GetCutVarV0CosPAExp0Slope(),
+                                  lV0Result->GetCutVarV0CosPAExp1Const(), lV0Result->GetCutVarV0CosPAExp1Slope(),
+                                  lV0Result->GetCutVarV0CosPAConst() );
+    }
+    lCuts.fV0CosPACut = lCuts.fV0CosPA;
+    lCuts.fPass.resize( lNumberOfConfigurations );
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::CompileCascadeCutTable()
+{
+    //Copy the cuts of the configurations in fListCascade into the cut table
+    //used in UserExec, one array per cut
+    delete fCascadeCutTable;
+    fCascadeCutTable = new AliCascadeCutTable();
+    AliCascadeCutTable &lCuts = *fCascadeCutTable;
+    const Int_t lNumberOfConfigurationsCascade = fListCascade->GetEntries();
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
+        AliCascadeResult *lCascadeResult = (AliCascadeResult*) fListCascade->At(lcfg);
+        Int_t lHypo = 4; //none
+        Short_t lCharge = -2;
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus    ){ lHypo = 0; lCharge = -1; }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus     ){ lHypo = 1; lCharge = +1; }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus ){ lHypo = 2; lCharge = -1; }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus  ){ lHypo = 3; lCharge = +1; }
+        if ( lHypo != 4 && lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+
+        lCuts.fHisto.push_back( lCascadeResult->GetHistogram() );
+        lCuts.fHypo.push_back( lHypo );
+        lCuts.fCharge.push_back( lCharge );
+        lCuts.fMinEta.push_back( lCascadeResult->GetCutMinEtaTracks() );
+        lCuts.fMaxEta.push_back( lCascadeResult->GetCutMaxEtaTracks() );
+        lCuts.fMinRap.push_back( lCascadeResult->GetCutMinRapidity() );
+        lCuts.fMaxRap.push_back( lCascadeResult->GetCutMaxRapidity() );
+        lCuts.fDCANegToPV.push_back( lCascadeResult->GetCutDCANegToPV() );
+        lCuts.fDCAPosToPV.push_back( lCascadeResult->GetCutDCAPosToPV() );
+        lCuts.fDCAV0Daughters.push_back( lCascadeResult->GetCutDCAV0Daughters() );
+        lCuts.fV0Radius.push_back( lCascadeResult->GetCutV0Radius() );
+        lCuts.fDCAV0ToPV.push_back( lCascadeResult->GetCutDCAV0ToPV() );
+        lCuts.fV0Mass.push_back( lCascadeResult->GetCutV0Mass() );
+        lCuts.fDCABachToPV.push_back( lCascadeResult->GetCutDCABachToPV() );
+        lCuts.fDCACascDaughters.push_back( lCascadeResult->GetCutDCACascDaughters() );
+        lCuts.fCascRadius.push_back( lCascadeResult->GetCutCascRadius() );
+        lCuts.fV0MassSigma.push_back( lCascadeResult->GetCutV0MassSigma() );
+        lCuts.fProperLifetime.push_back( lCascadeResult->GetCutProperLifetime() );
+        lCuts.fLeastClusters.push_back( lCascadeResult->GetCutLeastNumberOfClusters() );
+        lCuts.fTPCdEdx.push_back( lCascadeResult->GetCutTPCdEdx() );
+        lCuts.fXiRejection.push_back( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus || lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus );
+        lCuts.fXiRejectionCut.push_back( lCascadeResult->GetCutXiRejection() );
+        lCuts.fDCABachToBaryon.push_back( lCascadeResult->GetCutDCABachToBaryon() );
+        lCuts.fMinV0Lifetime.push_back( lCascadeResult->GetCutMinV0Lifetime() );
+        lCuts.fMaxV0Lifetime.push_back( lCascadeResult->GetCutMaxV0Lifetime() );
+        lCuts.fITSRefit.push_back( lCascadeResult->GetCutUseITSRefitTracks() );
+        lCuts.fMaxChi2PerCluster.push_back( lCascadeResult->GetCutMaxChi2PerCluster() );
+        lCuts.fMinTrackLength.push_back( lCascadeResult->GetCutMinTrackLength() );
+        lCuts.f276TeVV0CosPA.push_back( lCascadeResult->GetCutUse276TeVV0CosPA() );
+        lCuts.fCascCosPA.push_back( lCascadeResult->GetCutCascCosPA() );
+        lCuts.fV0CosPA.push_back( lCascadeResult->GetCutV0CosPA() );
+        lCuts.fBBCosPA.push_back( lCascadeResult->GetCutBachBaryonCosPA() );
+        if( lCascadeResult->GetCutUseVarCascCosPA() )
+            lCuts.fVarCascCosPA.Add( lcfg,
+                                    lCascadeResult->GetCutVarCascCosPAExp0Const(), lCascadeResult->GetCutVarCascCosPAExp0Slope(),
+                                    lCascadeResult->GetCutVarCascCosPAExp1Const(), lCascadeResult->GetCutVarCascCosPAExp1Slope(),
+                                    lCascadeResult->GetCutVarCascCosPAConst() );
+        if( lCascadeResult->GetCutUseVarV0CosPA() )
+            lCuts.fVarV0CosPA.Add( lcfg,
+                                  lCascadeResult->GetCutVarV0CosPAExp0Const(), lCascadeResult->GetCutVarV0CosPAExp0Slope(),
+                                  lCascadeResult->GetCutVarV0CosPAExp1Const(), lCascadeResult->GetCutVarV0CosPAExp1Slope(),
+                                  lCascadeResult->GetCutVarV0CosPAConst() );
+        if( lCascadeResult->GetCutUseVarBBCosPA() )
+            lCuts.fVarBBCosPA.Add( lcfg,
+                                  lCascadeResult->GetCutVarBBCosPAExp0Const(), lCascadeResult->GetCutVarBBCosPAExp0Slope(),
+                                  lCascadeResult->GetCutVarBBCosPAExp1Const(), lCascadeResult->GetCutVarBBCosPAExp1Slope(),
+                                  lCascadeResult->GetCutVarBBCosPAConst() );
+    }
+    lCuts.fCascCosPACut = lCuts.fCascCosPA;
+    lCuts.fV0CosPACut   = lCuts.fV0CosPA;
+    lCuts.fBBCosPACut   = lCuts.fBBCosPA;
+    lCuts.fPass.resize( lNumberOfConfigurationsCascade );
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskStrangenessVsMultiplicityRun2::SetupStandardVertexing()
 //Meant to store standard re-vertexing configuration
@@ -43,6 +43,8 @@ class AliESDFMD;
 class AliCFContainer;
 class AliV0Result;
 class AliCascadeResult;
+class AliV0CutTable;
+class AliCascadeCutTable;
 
 //#include "TString.h"
 //#include "AliESDtrackCuts.h"
@@ -484,10 +486,20 @@ private:
     TH1D *fHistEventCounter; //!
     TH1D *fHistCentrality; //!
 
+//===========================================================================================
+//   Superlight mode: configurations compiled into cut tables (see CompileV0CutTable)
+//===========================================================================================
+
+    AliV0CutTable      *fV0CutTable;      //! cuts of fListV0, one array per cut
+    AliCascadeCutTable *fCascadeCutTable; //! cuts of fListCascade, one array per cut
+
+    void CompileV0CutTable();
+    void CompileCascadeCutTable();
+
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
-    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 2);
+    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 3);
     //1: first implementation
 };
 